@@ -0,0 +1,160 @@
+/***************************************************************************
+ * bench.cpp - Core microbenchmarks
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "bench.hpp"
+#include "../src/core/framerate.hpp"
+#include "../src/core/property_helper.hpp"
+#include "../src/video/video.hpp"
+
+using namespace std;
+
+namespace TSC {
+
+volatile size_t g_bench_sink = 0;
+
+/* *** *** *** *** *** cBench_Runner *** *** *** *** *** *** *** *** *** *** *** *** */
+
+cBench_Runner::cBench_Runner(void)
+{
+    m_samples = 15;
+    m_min_sample_time = 20000000; // 20 ms
+}
+
+bool cBench_Runner::Is_Enabled(const std::string& name) const
+{
+    return m_filter.empty() || name.find(m_filter) != std::string::npos;
+}
+
+// nanoseconds needed for the given number of calls
+static uint64_t Time_Calls(const std::function<void()>& func, uint64_t calls)
+{
+    const chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+    for (uint64_t i = 0; i < calls; i++) {
+        func();
+    }
+
+    return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count();
+}
+
+void cBench_Runner::Run(const std::string& name, unsigned int ops, const std::function<void()>& func)
+{
+    if (!Is_Enabled(name)) {
+        return;
+    }
+
+    cerr << "Running " << name << endl;
+
+    // warm up and get the calls needed for the minimum sample duration
+    uint64_t calls = 1;
+    uint64_t time = Time_Calls(func, calls);
+
+    while (time < m_min_sample_time / 4) {
+        calls *= 2;
+        time = Time_Calls(func, calls);
+    }
+
+    if (time < m_min_sample_time) {
+        calls = calls * m_min_sample_time / max<uint64_t>(time, 1);
+    }
+
+    vector<double> ns_per_op;
+
+    for (unsigned int i = 0; i < m_samples; i++) {
+        ns_per_op.push_back(static_cast<double>(Time_Calls(func, calls)) / static_cast<double>(calls * ops));
+    }
+
+    sort(ns_per_op.begin(), ns_per_op.end());
+
+    cout << "{\"benchmark\": \"" << name << "\", "
+         << "\"ops_per_sample\": " << calls * ops << ", "
+         << "\"samples\": " << m_samples << ", "
+         << fixed << setprecision(3)
+         << "\"ns_per_op\": " << ns_per_op[ns_per_op.size() / 2] << ", "
+         << "\"min_ns_per_op\": " << ns_per_op.front() << ", "
+         << "\"max_ns_per_op\": " << ns_per_op.back() << "}" << endl;
+    cout.unsetf(ios::fixed);
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+using namespace TSC;
+
+int main(int argc, char** argv)
+{
+    cBench_Runner runner;
+    runner.m_data_dir = TSC_BENCH_DATA_DIR;
+
+    vector<std::string> arguments(argv, argv + argc);
+
+    for (unsigned int i = 1; i < arguments.size(); i++) {
+        if (arguments[i] == "--help" || arguments[i] == "-h") {
+            cout << "Usage: " << arguments[0] << " [OPTIONS]" << endl;
+            cout << "Where OPTIONS is one of the following:" << endl;
+            cout << "-h, --help\tDisplay this message" << endl;
+            cout << "-f, --filter\tOnly run benchmarks containing the given text" << endl;
+            cout << "-s, --samples\tNumber of timed samples per benchmark" << endl;
+            cout << "-d, --data\tGame data directory with the level files" << endl;
+            return EXIT_SUCCESS;
+        }
+        else if (i + 1 >= arguments.size()) {
+            cerr << "Unknown argument " << arguments[i] << endl << "Use -h to list all possible arguments" << endl;
+            return EXIT_FAILURE;
+        }
+        else if (arguments[i] == "--filter" || arguments[i] == "-f") {
+            runner.m_filter = arguments[++i];
+        }
+        else if (arguments[i] == "--samples" || arguments[i] == "-s") {
+            runner.m_samples = max(string_to_int(arguments[++i]), 1);
+        }
+        else if (arguments[i] == "--data" || arguments[i] == "-d") {
+            runner.m_data_dir = utf8_to_path(arguments[++i]);
+        }
+        else {
+            cerr << "Unknown argument " << arguments[i] << endl << "Use -h to list all possible arguments" << endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    // used by the sprites
+    pFramerate = new cFramerate();
+    // no window is opened. Not deleted as the destructor expects an initialized CEGUI.
+    pVideo = new cVideo();
+
+    // describe the build the results belong to
+    cout << "{\"tsc_bench\": \"" << TSC_VERSION_MAJOR << "." << TSC_VERSION_MINOR << "." << TSC_VERSION_PATCH << "\"";
+#ifdef TSC_VERSION_GIT
+    cout << ", \"git\": \"" << TSC_VERSION_GIT << "\"";
+#endif
+#ifdef _DEBUG
+    cout << ", \"debug\": true";
+#else
+    cout << ", \"debug\": false";
+#endif
+    cout << "}" << endl;
+
+    Bench_Collision(runner);
+    Bench_Render_Queue(runner);
+    Bench_Level_Parsing(runner);
+    Bench_Xml_Attributes(runner);
+    Bench_Downscale(runner);
+
+    delete pFramerate;
+    pFramerate = NULL;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,68 @@
+/***************************************************************************
+ * bench.hpp - Core microbenchmarks
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_BENCH_HPP
+#define TSC_BENCH_HPP
+
+#include "../src/core/global_basic.hpp"
+
+namespace TSC {
+
+    /* *** *** *** *** *** cBench_Runner *** *** *** *** *** *** *** *** *** *** *** *** */
+
+    /* Times the benchmarks and prints the results
+     * Each result is printed as one JSON object per line on stdout so it can
+     * be collected and compared between builds. Progress goes to stderr.
+    */
+    class cBench_Runner {
+    public:
+        cBench_Runner(void);
+
+        // returns true if the benchmark with the given name should run
+        bool Is_Enabled(const std::string& name) const;
+
+        /* Time the given function
+         * name : benchmark name
+         * ops : operations done by one call of func
+        */
+        void Run(const std::string& name, unsigned int ops, const std::function<void()>& func);
+
+        // only run benchmarks with a name containing this text
+        std::string m_filter;
+        // timed samples per benchmark
+        unsigned int m_samples;
+        // minimum duration of a sample in nanoseconds
+        uint64_t m_min_sample_time;
+        // game data directory
+        boost::filesystem::path m_data_dir;
+    };
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+    // results are added here so the benchmarked code is not optimized away
+    extern volatile size_t g_bench_sink;
+
+    // benchmark groups
+    void Bench_Collision(cBench_Runner& runner);
+    void Bench_Render_Queue(cBench_Runner& runner);
+    void Bench_Level_Parsing(cBench_Runner& runner);
+    void Bench_Xml_Attributes(cBench_Runner& runner);
+    void Bench_Downscale(cBench_Runner& runner);
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
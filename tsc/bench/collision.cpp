@@ -0,0 +1,81 @@
+/***************************************************************************
+ * collision.cpp - Collision check benchmarks
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "bench.hpp"
+#include "../src/core/sprite_manager.hpp"
+#include "../src/core/collision.hpp"
+#include "../src/objects/movingsprite.hpp"
+#include "../src/video/gl_surface.hpp"
+
+using namespace std;
+
+namespace TSC {
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+// level size in blocks
+static const int bench_level_w = 200;
+static const int bench_level_h = 15;
+// checked rects per benchmark call
+static const unsigned int bench_collision_checks = 256;
+
+void Bench_Collision(cBench_Runner& runner)
+{
+    if (!runner.Is_Enabled("collision_check")) {
+        return;
+    }
+
+    // block image without a texture
+    cGL_Surface surface;
+    surface.m_auto_del_img = 0;
+    surface.m_w = surface.m_start_w = surface.m_col_w = 32.0f;
+    surface.m_h = surface.m_start_h = surface.m_col_h = 32.0f;
+
+    cSprite_Manager sprite_manager(bench_level_w * bench_level_h);
+
+    // ground and platforms with gaps like a typical level
+    for (int y = 0; y < bench_level_h; y++) {
+        for (int x = 0; x < bench_level_w; x++) {
+            if ((x * 7 + y * 3) % 5 == 0) {
+                continue;
+            }
+
+            cSprite* sprite = new cSprite(&sprite_manager);
+            sprite->Set_Image(&surface, 1);
+            sprite->Set_Pos(x * 32.0f, y * -32.0f, 1);
+            sprite_manager.Add(sprite);
+            sprite->Set_Massive_Type((x + y) % 4 ? MASS_MASSIVE : MASS_HALFMASSIVE);
+        }
+    }
+
+    cMovingSprite moving_sprite(&sprite_manager);
+    moving_sprite.Set_Image(&surface, 1);
+    moving_sprite.m_vely = 1.0f;
+
+    runner.Run("collision_check", bench_collision_checks, [&]() {
+        for (unsigned int i = 0; i < bench_collision_checks; i++) {
+            const float x = static_cast<float>((i * 97) % (bench_level_w * 32));
+            const float y = -static_cast<float>((i * 31) % (bench_level_h * 32));
+
+            cObjectCollisionType* col_list = moving_sprite.Collision_Check_Absolute(x, y, 32.0f, 32.0f, COLLIDE_COMPLETE, &sprite_manager.objects);
+            g_bench_sink += col_list->size();
+            delete col_list;
+        }
+    });
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
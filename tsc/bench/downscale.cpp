@@ -0,0 +1,55 @@
+/***************************************************************************
+ * downscale.cpp - Image downscaling benchmarks
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "bench.hpp"
+#include "../src/core/property_helper.hpp"
+#include "../src/video/video.hpp"
+
+using namespace std;
+
+namespace TSC {
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+// source image size, RGBA like the images from SFML
+static const int bench_image_size = 512;
+static const int bench_image_channels = 4;
+
+void Bench_Downscale(cBench_Runner& runner)
+{
+    vector<unsigned char> image(bench_image_size * bench_image_size * bench_image_channels);
+    uint32_t random = 12345;
+
+    for (size_t i = 0; i < image.size(); i++) {
+        random = random * 1103515245 + 12345;
+        image[i] = static_cast<unsigned char>(random >> 24);
+    }
+
+    const int block_sizes[] = {2, 4};
+
+    for (unsigned int i = 0; i < sizeof(block_sizes) / sizeof(block_sizes[0]); i++) {
+        const int block_size = block_sizes[i];
+        vector<unsigned char> resampled((bench_image_size / block_size) * (bench_image_size / block_size) * bench_image_channels);
+
+        runner.Run("downscale_image_" + int_to_string(block_size) + "x", 1, [&]() {
+            pVideo->Downscale_Image(&image[0], bench_image_size, bench_image_size, bench_image_channels, &resampled[0], block_size, block_size);
+            g_bench_sink += resampled[0];
+        });
+    }
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
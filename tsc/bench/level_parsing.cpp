@@ -0,0 +1,94 @@
+/***************************************************************************
+ * level_parsing.cpp - Level XML parsing benchmarks
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "bench.hpp"
+#include "../src/level/level_xml_parser.hpp"
+
+using namespace std;
+
+namespace fs = boost::filesystem;
+
+namespace TSC {
+
+/* *** *** *** *** *** cBench_Level_Parser *** *** *** *** *** *** *** *** *** *** *** *** */
+
+/* Parses a level with the XML handling of cLevelLoader without creating the level
+ * cLevelLoader creates the sprites with their textures which needs an
+ * OpenGL context. This only counts the properties of each element, so the
+ * XML side of level loading can be measured.
+*/
+class cBench_Level_Parser : public cLevel_XML_Parser {
+public:
+    cBench_Level_Parser(void)
+        : cLevel_XML_Parser()
+    {
+        m_elements = 0;
+    }
+
+    // parsed elements with their properties
+    size_t m_elements;
+protected:
+    virtual void Handle_Element(const std::string& name)
+    {
+        m_elements += m_current_properties.size();
+    }
+};
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+void Bench_Level_Parsing(cBench_Runner& runner)
+{
+    if (!runner.Is_Enabled("level_xml_parse")) {
+        return;
+    }
+
+    const fs::path levels_dir = runner.m_data_dir / utf8_to_path("levels");
+    vector<std::string> levels;
+
+    if (fs::is_directory(levels_dir)) {
+        // sorted for the same order on every run
+        vector<fs::path> filenames;
+
+        for (fs::directory_iterator itr(levels_dir); itr != fs::directory_iterator(); ++itr) {
+            if (itr->path().extension() == utf8_to_path(".tsclvl")) {
+                filenames.push_back(itr->path());
+            }
+        }
+
+        sort(filenames.begin(), filenames.end());
+
+        for (vector<fs::path>::iterator itr = filenames.begin(); itr != filenames.end(); ++itr) {
+            fs::ifstream file(*itr, ios::in | ios::binary);
+            levels.push_back(std::string(istreambuf_iterator<char>(file), istreambuf_iterator<char>()));
+        }
+    }
+
+    if (levels.empty()) {
+        cerr << "Warning : No levels found in " << path_to_utf8(levels_dir) << ", skipping level_xml_parse" << endl;
+        return;
+    }
+
+    runner.Run("level_xml_parse", levels.size(), [&]() {
+        for (vector<std::string>::iterator itr = levels.begin(); itr != levels.end(); ++itr) {
+            cBench_Level_Parser parser;
+            parser.parse_memory(*itr);
+            g_bench_sink += parser.m_elements;
+        }
+    });
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
@@ -0,0 +1,60 @@
+/***************************************************************************
+ * render_queue.cpp - Render queue benchmarks
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "bench.hpp"
+#include "../src/video/renderer.hpp"
+
+using namespace std;
+
+namespace TSC {
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+// requests of a busy frame
+static const unsigned int bench_render_requests = 2000;
+
+void Bench_Render_Queue(cBench_Runner& runner)
+{
+    if (!runner.Is_Enabled("render_queue_sort")) {
+        return;
+    }
+
+    cRenderQueue queue(bench_render_requests);
+    uint32_t random = 12345;
+
+    // sprites are added in sprite manager order which is mostly but not
+    // fully sorted by layer, with small z differences inside a layer
+    for (unsigned int i = 0; i < bench_render_requests; i++) {
+        random = random * 1103515245 + 12345;
+
+        cSurface_Request* request = new cSurface_Request();
+        request->m_pos_z = (i * 8 / bench_render_requests) * 0.01f + ((random >> 16) % 1000) * 0.000001f;
+        queue.Add(request);
+    }
+
+    const RenderList unsorted = queue.m_render_data;
+
+    runner.Run("render_queue_sort", 1, [&]() {
+        queue.m_render_data = unsorted;
+        queue.Sort();
+        g_bench_sink += static_cast<size_t>(queue.m_render_data.front()->m_pos_z * 1000000.0f);
+    });
+
+    queue.Clear();
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
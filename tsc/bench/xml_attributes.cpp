@@ -0,0 +1,69 @@
+/***************************************************************************
+ * xml_attributes.cpp - XmlAttributes lookup benchmarks
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "bench.hpp"
+#include "../src/core/xml_attributes.hpp"
+
+using namespace std;
+
+namespace TSC {
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+// lookups per benchmark call
+static const unsigned int bench_attribute_lookups = 8;
+
+void Bench_Xml_Attributes(cBench_Runner& runner)
+{
+    // properties of a typical enemy in a level file
+    XmlAttributes attributes;
+    attributes["posx"] = "1184";
+    attributes["posy"] = "-448";
+    attributes["uid"] = "126";
+    attributes["direction"] = "left";
+    attributes["color"] = "red";
+    attributes["max_distance"] = "200";
+    attributes["speed"] = "2.5";
+    attributes["image"] = "enemy/furball/brown/turn.png";
+    attributes["massive_type"] = "massive";
+    attributes["type"] = "furball";
+
+    // the same lookups the sprite constructors do including missing keys
+    runner.Run("xml_attributes_fetch", bench_attribute_lookups, [&]() {
+        g_bench_sink += static_cast<size_t>(attributes.fetch<float>("posx", 0.0f));
+        g_bench_sink += static_cast<size_t>(attributes.fetch<float>("posy", 0.0f));
+        g_bench_sink += attributes.fetch<int>("uid", -1);
+        g_bench_sink += attributes.fetch<std::string>("direction", "right").size();
+        g_bench_sink += attributes.fetch<std::string>("color", "brown").size();
+        g_bench_sink += static_cast<size_t>(attributes.fetch<float>("speed", 1.0f));
+        g_bench_sink += attributes.fetch<int>("level_ends_if_killed", 0);
+        g_bench_sink += attributes.exists("boss");
+    });
+
+    runner.Run("xml_attributes_index", bench_attribute_lookups, [&]() {
+        g_bench_sink += attributes["posx"].size();
+        g_bench_sink += attributes["posy"].size();
+        g_bench_sink += attributes["uid"].size();
+        g_bench_sink += attributes["direction"].size();
+        g_bench_sink += attributes["color"].size();
+        g_bench_sink += attributes["max_distance"].size();
+        g_bench_sink += attributes["image"].size();
+        g_bench_sink += attributes["type"].size();
+    });
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
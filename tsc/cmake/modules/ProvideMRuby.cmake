@@ -24,4 +24,8 @@ else()
     INSTALL_COMMAND "")
 
   set(MRuby_INCLUDE_DIR ${TSC_SOURCE_DIR}/../mruby/mruby/include)
+
+  # The script watchdog uses the code fetch hook. This changes the layout
+  # of mrb_state, so it has to match mruby_tsc_build_config.rb.
+  add_definitions(-DMRB_ENABLE_DEBUG_HOOK)
 endif()
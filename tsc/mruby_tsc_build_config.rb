@@ -60,5 +60,9 @@ MRuby::Build.new do |conf|
     cc.flags += ["-DMRB_UTF8_STRING"]
   end
 
+  # Needed for the script watchdog. Must match ProvideMRuby.cmake
+  # as it changes the layout of mrb_state.
+  conf.cc.defines << "MRB_ENABLE_DEBUG_HOOK"
+
   config.call(conf, root)
 end
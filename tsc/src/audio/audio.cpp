@@ -23,6 +23,7 @@
 #include "../core/filesystem/filesystem.hpp"
 #include "../core/filesystem/resource_manager.hpp"
 #include "../core/global_basic.hpp"
+#include "../core/job_system.hpp"
 
 using namespace std;
 
@@ -31,15 +32,31 @@ namespace fs = boost::filesystem;
 namespace TSC {
 /* *** *** *** *** *** *** *** *** Audio Sound *** *** *** *** *** *** *** *** *** */
 
+// sounds with a lower audibility don't get a mixer channel
+static const float min_sound_audibility = 0.01f;
+
 cAudio_Sound::cAudio_Sound(void)
 {
     m_data = NULL;
+    m_channel = NULL;
+    m_stream = NULL;
     m_resource_id = -1;
+    m_in_use = 0;
+    m_priority = SOUND_PRIORITY_NORMAL;
+    m_volume = MAX_VOLUME;
+
+    m_virtual_playing = 0;
+    m_virtual_offset = sf::Time::Zero;
 }
 
 cAudio_Sound::~cAudio_Sound(void)
 {
     Free();
+
+    if (m_stream) {
+        delete m_stream;
+        m_stream = NULL;
+    }
 }
 
 void cAudio_Sound::Load(cSound* data)
@@ -59,6 +76,7 @@ void cAudio_Sound::Free(void)
     }
 
     m_resource_id = -1;
+    m_priority = SOUND_PRIORITY_NORMAL;
 }
 
 bool cAudio_Sound::Play(int use_res_id /* = -1 */, bool loops /* = false */)
@@ -85,21 +103,171 @@ bool cAudio_Sound::Play(int use_res_id /* = -1 */, bool loops /* = false */)
     }
 
     m_resource_id = use_res_id;
-    // play sound
-    m_sound.setBuffer(m_data->m_buffer);
-    m_sound.play();
+
+    // start virtually from the beginning
+    m_virtual_playing = 1;
+    m_virtual_offset = sf::Time::Zero;
+    m_virtual_time = std::chrono::steady_clock::now();
+
+    // play sound if audible
+    pAudio->Assign_Mixer_Channel(this);
 
     return 1;
 }
 
 void cAudio_Sound::Stop(void)
 {
-    // if not loaded
-    if (!m_data) {
+    m_virtual_playing = 0;
+
+    if (!m_channel) {
+        return;
+    }
+
+    if (m_stream) {
+        m_stream->stop();
+    }
+
+    m_channel->stop();
+    m_channel->resetBuffer();
+
+    if (pAudio) {
+        pAudio->Release_Mixer_Channel(m_channel);
+    }
+
+    m_channel = NULL;
+}
+
+void cAudio_Sound::Set_Volume(float volume)
+{
+    m_volume = volume;
+
+    if (!m_channel) {
+        return;
+    }
+
+    if (m_data->m_streamed) {
+        m_stream->setVolume(volume);
+    }
+    else {
+        m_channel->setVolume(volume);
+    }
+}
+
+bool cAudio_Sound::Is_Playing(void) const
+{
+    if (m_channel) {
+        if (m_data->m_streamed) {
+            return m_stream->getStatus() == sf::SoundSource::Playing;
+        }
+
+        return m_channel->getStatus() == sf::SoundSource::Playing;
+    }
+
+    if (!m_virtual_playing || !m_data) {
+        return 0;
+    }
+
+    // virtual voice until its end
+    return Get_Playing_Offset() < m_data->Get_Duration();
+}
+
+bool cAudio_Sound::Is_Virtual(void) const
+{
+    return !m_channel;
+}
+
+float cAudio_Sound::Get_Audibility(void) const
+{
+    return m_volume / static_cast<float>(MAX_VOLUME);
+}
+
+bool cAudio_Sound::Is_Less_Important(const cAudio_Sound* other) const
+{
+    // priority always wins over audibility
+    if (m_priority != other->m_priority) {
+        return m_priority < other->m_priority;
+    }
+
+    return Get_Audibility() < other->Get_Audibility();
+}
+
+sf::Time cAudio_Sound::Get_Playing_Offset(void) const
+{
+    if (m_channel) {
+        if (m_data->m_streamed) {
+            return m_stream->getPlayingOffset();
+        }
+
+        return m_channel->getPlayingOffset();
+    }
+
+    if (!m_virtual_playing) {
+        return m_virtual_offset;
+    }
+
+    std::chrono::microseconds passed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_virtual_time);
+    return m_virtual_offset + sf::microseconds(passed.count());
+}
+
+void cAudio_Sound::Virtualize(void)
+{
+    if (!m_channel) {
+        return;
+    }
+
+    // remember the position
+    m_virtual_playing = Is_Playing();
+    m_virtual_offset = Get_Playing_Offset();
+    m_virtual_time = std::chrono::steady_clock::now();
+
+    if (m_stream) {
+        m_stream->stop();
+    }
+
+    m_channel->stop();
+    m_channel->resetBuffer();
+    pAudio->Release_Mixer_Channel(m_channel);
+    m_channel = NULL;
+}
+
+void cAudio_Sound::Realize(sf::Sound* channel)
+{
+    const sf::Time offset = Get_Playing_Offset();
+
+    m_channel = channel;
+    m_virtual_playing = 0;
+
+    /* streamed sounds only reserve the mixer channel and play
+     * through the stream of this voice
+    */
+    if (m_data->m_streamed) {
+        if (!m_stream) {
+            m_stream = new cSound_Stream();
+        }
+
+        if (!m_stream->Open(m_data)) {
+            return;
+        }
+
+        m_stream->setVolume(m_volume);
+        m_stream->play();
+
+        // continue at the virtual position
+        if (offset > sf::Time::Zero) {
+            m_stream->setPlayingOffset(offset);
+        }
+
         return;
     }
 
-    m_sound.stop();
+    m_channel->setBuffer(m_data->m_buffer);
+    m_channel->setVolume(m_volume);
+    m_channel->play();
+
+    // continue at the virtual position
+    if (offset > sf::Time::Zero) {
+        m_channel->setPlayingOffset(offset);
+    }
 }
 
 /* *** *** *** *** *** *** *** *** Audio *** *** *** *** *** *** *** *** *** */
@@ -164,7 +332,9 @@ bool cAudio::Init(void)
         m_sound_enabled = 0;
     }
 
-    m_max_sounds = 100; // XXX: what???
+    // mixer channels and voices including virtual ones
+    m_max_sounds = 64;
+    m_max_voices = 256;
 
     return 1;
 }
@@ -185,8 +355,24 @@ void cAudio::Close(bool close_sound/*=true*/, bool close_music/*=true*/)
             }
 
             m_active_sounds.clear();
+            m_free_sounds.clear();
+            m_restore_sounds.clear();
+
+            // clear mixer channels
+            for (vector<sf::Sound*>::iterator itr = m_mixer_channels.begin(); itr != m_mixer_channels.end(); ++itr) {
+                delete *itr;
+            }
+
+            m_mixer_channels.clear();
+            m_free_mixer_channels.clear();
+
+            // the sound manager may delete the sounds
+            for (AudioSoundHandleList::iterator itr = m_sound_handles.begin(); itr != m_sound_handles.end(); ++itr) {
+                itr->m_data = NULL;
+            }
 
             m_max_sounds = 0;
+            m_max_voices = 0;
             m_sound_enabled = 0;
         }
 
@@ -202,47 +388,63 @@ void cAudio::Close(bool close_sound/*=true*/, bool close_music/*=true*/)
     m_fade_direction = FadeDirection::NONE;
 }
 
-cSound* cAudio::Get_Sound_File(fs::path filename) const
+cSound* cAudio::Get_Sound_File(fs::path filename)
 {
     if (!m_initialised || !m_sound_enabled) {
         return NULL;
     }
 
+    int handle = Get_Sound_Handle(filename);
+
     // not available
-    if (!File_Exists(filename)) {
-        // add sound directory if required
-        if (!filename.is_absolute())
-            filename = pResource_Manager->Get_Game_Sounds_Directory() / filename;
+    if (handle < 0) {
+        return NULL;
     }
 
-    cSound* sound = pSound_Manager->Get_Pointer(filename);
+    return Load_Sound_Handle(handle);
+}
+
+cSound* cAudio::Load_Sound_Handle(int handle)
+{
+    cAudio_Sound_Handle& sound_handle = m_sound_handles[handle];
+
+    // if not already loaded
+    if (!sound_handle.m_data) {
+        cSound* sound = pSound_Manager->Get_Pointer(sound_handle.m_filename);
 
-    // if not already cached
-    if (!sound) {
-        sound = new cSound();
+        // if not already cached
+        if (!sound) {
+            sound = new cSound();
 
-        // loaded sound
-        if (sound->Load(filename)) {
-            pSound_Manager->Add(sound);
+            // loaded sound
+            if (sound->Load(sound_handle.m_filename)) {
+                pSound_Manager->Add(sound);
 
-            if (m_debug) {
-                cout << "Loaded sound file : " << filename.c_str() << endl;
+                if (m_debug) {
+                    cout << "Loaded sound file : " << sound_handle.m_filename.c_str() << endl;
+                }
+            }
+            // failed loading
+            else {
+                delete sound;
+                return NULL;
             }
         }
-        // failed loading
-        else {
-            delete sound;
-            return NULL;
-        }
+
+        sound_handle.m_data = sound;
     }
 
-    return sound;
+    return sound_handle.m_data;
 }
 
-bool cAudio::Play_Sound(fs::path filename, int res_id /* = -1 */, int volume /* = -1 */, bool loops /* = false */)
+int cAudio::Get_Sound_Handle(fs::path filename)
 {
-    if (!m_initialised || !m_sound_enabled) {
-        return 0;
+    const std::string key = path_to_utf8(filename);
+    std::unordered_map<std::string, int>::const_iterator itr = m_sound_handle_map.find(key);
+
+    // already resolved
+    if (itr != m_sound_handle_map.end()) {
+        return itr->second;
     }
 
     // not available
@@ -254,11 +456,64 @@ bool cAudio::Play_Sound(fs::path filename, int res_id /* = -1 */, int volume /*
         // not found
         if (!File_Exists(filename)) {
             cerr << "Warning: Could not find sound file '" << path_to_utf8(filename) << "'" << endl;
-            return false;
+            // don't search again
+            m_sound_handle_map[key] = -1;
+            return -1;
         }
     }
 
-    cSound* sound_data = Get_Sound_File(filename);
+    m_sound_handles.push_back(cAudio_Sound_Handle(filename));
+    int handle = m_sound_handles.size() - 1;
+    m_sound_handle_map[key] = handle;
+
+    return handle;
+}
+
+bool cAudio::Play_Sound(fs::path filename, int res_id /* = -1 */, int volume /* = -1 */, bool loops /* = false */, int priority /* = SOUND_PRIORITY_NORMAL */)
+{
+    if (!m_initialised || !m_sound_enabled) {
+        return 0;
+    }
+
+    // played after the parallel update
+    if (cJob_System::Is_In_Job()) {
+        cJob_System::Run_Synced([=]() {
+            Play_Sound(filename, res_id, volume, loops, priority);
+        });
+        return 1;
+    }
+
+    int handle = Get_Sound_Handle(filename);
+
+    // not found
+    if (handle < 0) {
+        return 0;
+    }
+
+    return Play_Sound_Handle(handle, res_id, volume, loops, priority);
+}
+
+bool cAudio::Play_Sound_Handle(int handle, int res_id /* = -1 */, int volume /* = -1 */, bool loops /* = false */, int priority /* = SOUND_PRIORITY_NORMAL */)
+{
+    if (!m_initialised || !m_sound_enabled) {
+        return 0;
+    }
+
+    // invalid handle
+    if (handle < 0 || handle >= static_cast<int>(m_sound_handles.size())) {
+        return 0;
+    }
+
+    // played after the parallel update
+    if (cJob_System::Is_In_Job()) {
+        cJob_System::Run_Synced([=]() {
+            Play_Sound_Handle(handle, res_id, volume, loops, priority);
+        });
+        return 1;
+    }
+
+    const fs::path& filename = m_sound_handles[handle].m_filename;
+    cSound* sound_data = Load_Sound_Handle(handle);
 
     // failed loading
     if (!sound_data) {
@@ -267,7 +522,7 @@ bool cAudio::Play_Sound(fs::path filename, int res_id /* = -1 */, int volume /*
     }
 
     // create channel
-    cAudio_Sound* sound = Create_Sound_Channel();
+    cAudio_Sound* sound = Create_Sound_Channel(priority);
 
     if (!sound) {
         // no free channel available
@@ -276,27 +531,26 @@ bool cAudio::Play_Sound(fs::path filename, int res_id /* = -1 */, int volume /*
 
     // load data
     sound->Load(sound_data);
+    sound->m_priority = priority;
+
+    // volume is out of range
+    if (volume > MAX_VOLUME) {
+        cerr << "PlaySound Volume is out of range : " << volume << endl;
+        volume = m_sound_volume;
+    }
+    // no volume is given
+    else if (volume < 0) {
+        volume = m_sound_volume;
+    }
+
+    // set volume before playing as it decides if a mixer channel is used
+    sound->Set_Volume(volume);
 
     // failed to play
     if (!sound->Play(res_id, loops)) {
         debug_print("Could not play sound file : %s\n", path_to_utf8(filename).c_str());
         return 0;
     }
-    // playing successfully
-    else {
-        // volume is out of range
-        if (volume > MAX_VOLUME) {
-            cerr << "PlaySound Volume is out of range : " << volume << endl;
-            volume = m_sound_volume;
-        }
-        // no volume is given
-        else if (volume < 0) {
-            volume = m_sound_volume;
-        }
-
-        // set volume
-        sound->m_sound.setVolume(volume);
-    }
 
     return 1;
 }
@@ -370,7 +624,7 @@ cAudio_Sound* cAudio::Get_Playing_Sound(fs::path filename)
         cAudio_Sound* obj = (*itr);
 
         // if not playing
-        if (obj->m_sound.getStatus() != sf::SoundSource::Playing) {
+        if (!obj->m_in_use || !obj->Is_Playing()) {
             continue;
         }
 
@@ -385,34 +639,158 @@ cAudio_Sound* cAudio::Get_Playing_Sound(fs::path filename)
     return NULL;
 }
 
-cAudio_Sound* cAudio::Create_Sound_Channel(void)
+cAudio_Sound* cAudio::Create_Sound_Channel(int priority /* = SOUND_PRIORITY_NORMAL */)
 {
-    assert(m_max_sounds > 0);
+    assert(m_max_voices > 0);
 
-    // get all sounds
-    for (AudioSoundList::iterator itr = m_active_sounds.begin(); itr != m_active_sounds.end(); ++itr) {
-        // get object pointer
-        cAudio_Sound* obj = (*itr);
+    // all voices were in use at the last update
+    if (m_free_sounds.empty() && m_active_sounds.size() >= m_max_voices) {
+        // check if one finished since then
+        Update_Sound_Channels();
+    }
 
-        // if not playing
-        if (obj->m_sound.getStatus() != sf::SoundSource::Playing) {
-            // found a free channel
-            obj->Free();
-            return obj;
-        }
+    // reuse a free voice
+    if (!m_free_sounds.empty()) {
+        cAudio_Sound* obj = m_free_sounds.back();
+        m_free_sounds.pop_back();
+
+        obj->Free();
+        obj->m_in_use = 1;
+        return obj;
     }
 
-    // if not maximum sounds
-    if (m_active_sounds.size() < m_max_sounds) {
+    // if not maximum voices
+    if (m_active_sounds.size() < m_max_voices) {
         cAudio_Sound* sound = new cAudio_Sound();
+        sound->m_in_use = 1;
         m_active_sounds.push_back(sound);
         return sound;
     }
 
+    // replace the least important virtual voice
+    cAudio_Sound* weakest = NULL;
+
+    for (AudioSoundList::iterator itr = m_active_sounds.begin(); itr != m_active_sounds.end(); ++itr) {
+        cAudio_Sound* obj = (*itr);
+
+        if (obj->Is_Virtual() && obj->m_priority <= priority && (!weakest || obj->Is_Less_Important(weakest))) {
+            weakest = obj;
+        }
+    }
+
+    if (weakest) {
+        weakest->Free();
+        return weakest;
+    }
+
     // none found
     return NULL;
 }
 
+void cAudio::Update_Sound_Channels(void)
+{
+    m_restore_sounds.clear();
+
+    for (AudioSoundList::iterator itr = m_active_sounds.begin(); itr != m_active_sounds.end(); ++itr) {
+        // get object pointer
+        cAudio_Sound* obj = (*itr);
+
+        if (!obj->m_in_use) {
+            continue;
+        }
+
+        // if finished playing
+        if (!obj->Is_Playing()) {
+            obj->Free();
+            obj->m_in_use = 0;
+            m_free_sounds.push_back(obj);
+        }
+        // can not be heard anymore
+        else if (!obj->Is_Virtual()) {
+            if (obj->Get_Audibility() < min_sound_audibility) {
+                obj->Virtualize();
+            }
+        }
+        // can be heard again
+        else if (obj->Get_Audibility() >= min_sound_audibility) {
+            m_restore_sounds.push_back(obj);
+        }
+    }
+
+    if (m_restore_sounds.empty()) {
+        return;
+    }
+
+    // most important first
+    std::sort(m_restore_sounds.begin(), m_restore_sounds.end(), [](const cAudio_Sound* a, const cAudio_Sound* b) {
+        return b->Is_Less_Important(a);
+    });
+
+    for (AudioSoundList::iterator itr = m_restore_sounds.begin(); itr != m_restore_sounds.end(); ++itr) {
+        // the following are not more important
+        if (!Assign_Mixer_Channel(*itr)) {
+            break;
+        }
+    }
+
+    m_restore_sounds.clear();
+}
+
+bool cAudio::Assign_Mixer_Channel(cAudio_Sound* sound)
+{
+    // already has one
+    if (sound->m_channel) {
+        return 1;
+    }
+
+    // inaudible sounds stay virtual
+    if (sound->Get_Audibility() < min_sound_audibility) {
+        return 0;
+    }
+
+    // if all channels are used
+    if (m_free_mixer_channels.empty() && m_mixer_channels.size() >= m_max_sounds) {
+        // get the least important playing sound
+        cAudio_Sound* weakest = NULL;
+
+        for (AudioSoundList::iterator itr = m_active_sounds.begin(); itr != m_active_sounds.end(); ++itr) {
+            cAudio_Sound* obj = (*itr);
+
+            if (obj->m_in_use && !obj->Is_Virtual() && (!weakest || obj->Is_Less_Important(weakest))) {
+                weakest = obj;
+            }
+        }
+
+        // not more important than any playing sound
+        if (!weakest || !weakest->Is_Less_Important(sound)) {
+            return 0;
+        }
+
+        // take its channel
+        weakest->Virtualize();
+    }
+
+    sf::Sound* channel = NULL;
+
+    if (!m_free_mixer_channels.empty()) {
+        channel = m_free_mixer_channels.back();
+        m_free_mixer_channels.pop_back();
+    }
+    else {
+        channel = new sf::Sound();
+        m_mixer_channels.push_back(channel);
+    }
+
+    sound->Realize(channel);
+
+    return 1;
+}
+
+void cAudio::Release_Mixer_Channel(sf::Sound* channel)
+{
+    m_free_mixer_channels.push_back(channel);
+}
+
 void cAudio::Toggle_Music(void)
 {
     pPreferences->m_audio_music = !pPreferences->m_audio_music;
@@ -541,7 +919,7 @@ void cAudio::Set_Sound_Volume(uint8_t volume)
         cAudio_Sound* obj = (*itr);
 
         // set volume
-        obj->m_sound.setVolume(volume);
+        obj->Set_Volume(volume);
     }
 }
 
@@ -562,7 +940,16 @@ void cAudio::Set_Music_Volume(uint8_t volume)
 
 void cAudio::Update(void)
 {
-    if (!m_initialised || !m_music_enabled) {
+    if (!m_initialised) {
+        return;
+    }
+
+    // make the finished channels available
+    if (m_sound_enabled) {
+        Update_Sound_Channels();
+    }
+
+    if (!m_music_enabled) {
         return;
     }
 
@@ -53,6 +53,15 @@ namespace TSC {
         RID_MOON            = 7
     };
 
+    /* *** *** *** *** *** *** *** Sound priorities *** *** *** *** *** *** *** *** *** *** */
+
+// sounds with a higher priority take the mixer channel of lower ones if all are used
+    enum SoundPriority {
+        SOUND_PRIORITY_LOW    = 0,
+        SOUND_PRIORITY_NORMAL = 1,
+        SOUND_PRIORITY_HIGH   = 2
+    };
+
     /* *** *** *** *** *** *** *** Audio Sound object *** *** *** *** *** *** *** *** *** *** */
 
 // Callback for a sound finished playing
@@ -73,22 +82,76 @@ namespace TSC {
         /* Play the Sound
          * use_res_id: if set stops all sounds using the same resource id.
          * loops : if set to true, loops indefinitely.
+         * if no mixer channel is available it starts as virtual sound
         */
         bool Play(int use_res_id = -1, bool loops = false);
         // Stop the Sound if playing
         void Stop(void);
 
+        // Set the volume ( 0 - MAX_VOLUME )
+        void Set_Volume(float volume);
+        // Returns true if playing, also if only virtual
+        bool Is_Playing(void) const;
+        // Returns true if playing without a mixer channel
+        bool Is_Virtual(void) const;
+        // Returns how well the sound can be heard ( 0.0 - 1.0 )
+        float Get_Audibility(void) const;
+        /* Returns true if less important than the given sound when handing out the mixer channels
+         * priority always wins over audibility
+        */
+        bool Is_Less_Important(const cAudio_Sound* other) const;
+        // Returns the current playing position
+        sf::Time Get_Playing_Offset(void) const;
+
+        // Give the mixer channel back and continue playing virtually
+        void Virtualize(void);
+        // Continue playing at the virtual position with the given mixer channel
+        void Realize(sf::Sound* channel);
+
         // sound object
         cSound* m_data;
 
-        // the current sound
-        sf::Sound m_sound;
+        // the mixer channel if audible else NULL
+        sf::Sound* m_channel;
+        // stream used instead of the mixer channel for streamed sounds
+        cSound_Stream* m_stream;
         // the last used resource id
         int m_resource_id;
+        // if the voice was handed out and is not in the free list
+        bool m_in_use;
+        // SoundPriority
+        int m_priority;
+        // volume including distance modifications
+        float m_volume;
+
+        // if playing virtually
+        bool m_virtual_playing;
+        // playing position when it became virtual
+        sf::Time m_virtual_offset;
+        // time it became virtual
+        std::chrono::steady_clock::time_point m_virtual_time;
     };
 
     typedef vector<cAudio_Sound*> AudioSoundList;
 
+    /* *** *** *** *** *** *** *** Sound handle *** *** *** *** *** *** *** *** *** *** */
+
+    /* A sound file resolved by cAudio::Get_Sound_Handle()
+     * playing it needs no filesystem access
+    */
+    class cAudio_Sound_Handle {
+    public:
+        cAudio_Sound_Handle(const boost::filesystem::path& filename)
+            : m_filename(filename), m_data(NULL) {}
+
+        // full sound filename
+        boost::filesystem::path m_filename;
+        // sound object if loaded else null
+        cSound* m_data;
+    };
+
+    typedef vector<cAudio_Sound_Handle> AudioSoundHandleList;
+
     /* *** *** *** *** *** *** *** Audio class *** *** *** *** *** *** *** *** *** *** */
 
     class cAudio: public Scripting::cScriptable_Object {
@@ -122,10 +185,24 @@ namespace TSC {
         /* Check if the sound was already loaded and returns a pointer to it else it will be loaded.
          * The returned sound should not be deleted or modified.
          */
-        cSound* Get_Sound_File(boost::filesystem::path filename) const;
+        cSound* Get_Sound_File(boost::filesystem::path filename);
+
+        /* Return the handle for the given sound file to play it with Play_Sound_Handle()
+         * the file is only searched the first time a filename is used
+         * `filename' should be relative to the sounds/ directory.
+         * returns -1 if the file does not exist
+         * handles stay valid as long as this object exists
+         */
+        int Get_Sound_Handle(boost::filesystem::path filename);
+        /* Return the sound of the given handle and load it if needed
+         * returns NULL if loading failed
+         */
+        cSound* Load_Sound_Handle(int handle);
 
         // Play the given sound. `filename' should be relative to the sounds/ directory.
-        bool Play_Sound(boost::filesystem::path filename, int res_id = -1, int volume = -1, bool loops = false);
+        bool Play_Sound(boost::filesystem::path filename, int res_id = -1, int volume = -1, bool loops = false, int priority = SOUND_PRIORITY_NORMAL);
+        // Play the sound from the given handle
+        bool Play_Sound_Handle(int handle, int res_id = -1, int volume = -1, bool loops = false, int priority = SOUND_PRIORITY_NORMAL);
         // If no forcing it will be played after the current music
         bool Play_Music(boost::filesystem::path filename, bool loops = false, bool force = 1, unsigned int fadein_ms = 0);
 
@@ -134,9 +211,21 @@ namespace TSC {
          */
         cAudio_Sound* Get_Playing_Sound(boost::filesystem::path filename);
 
-        /* Returns true if a free channel for the sound is available
+        /* Returns a free voice for a sound with the given priority
+         * if none is available returns NULL
+        */
+        cAudio_Sound* Create_Sound_Channel(int priority = SOUND_PRIORITY_NORMAL);
+        /* Move the voices which finished playing to the free list
+         * and hand out the mixer channels to the most important audible voices
         */
-        cAudio_Sound* Create_Sound_Channel(void);
+        void Update_Sound_Channels(void);
+        /* Give the sound a mixer channel
+         * takes the channel from a less important sound if all are used
+         * returns false if the sound stays virtual
+        */
+        bool Assign_Mixer_Channel(cAudio_Sound* sound);
+        // Return an unused mixer channel
+        void Release_Mixer_Channel(sf::Sound* channel);
 
         // Toggle Music on/off
         void Toggle_Music(void);
@@ -204,9 +293,25 @@ namespace TSC {
 
         // The current sounds pointer array
         AudioSoundList m_active_sounds;
-
-        // maximum sounds allowed at once
+        // voices from m_active_sounds which are not playing
+        AudioSoundList m_free_sounds;
+        // virtual voices which can be heard again
+        AudioSoundList m_restore_sounds;
+
+        // all mixer channels
+        vector<sf::Sound*> m_mixer_channels;
+        // mixer channels not used by a voice
+        vector<sf::Sound*> m_free_mixer_channels;
+
+        // resolved sound files
+        AudioSoundHandleList m_sound_handles;
+        // requested filename to handle
+        std::unordered_map<std::string, int> m_sound_handle_map;
+
+        // maximum sounds mixed at once
         unsigned int m_max_sounds;
+        // maximum sounds including virtual ones
+        unsigned int m_max_voices;
     };
 
     /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
@@ -79,6 +79,8 @@ void cRandom_Sound::Init(void)
     m_massive_type = MASS_PASSIVE;
     m_editor_pos_z = 0.111f;
     m_camera_range = 0;
+    // changes the volume with the camera distance
+    m_always_active = 1;
     m_name = "Sound";
 
     m_rect.m_w = 10.0f;
@@ -320,7 +322,7 @@ void cRandom_Sound::Update(void)
             // set to mixer volume
             sound_volume *= static_cast<float>(MAX_VOLUME);
             // set volume
-            sound->m_sound.setVolume(static_cast<uint8_t>(sound_volume));
+            sound->Set_Volume(static_cast<uint8_t>(sound_volume));
 
             // update volume every 100 ms
             m_volume_update_counter = 100.0f;
@@ -370,7 +372,7 @@ void cRandom_Sound::Update(void)
         sound_volume *= static_cast<float>(MAX_VOLUME);
 
         // play sound
-        pAudio->Play_Sound(m_filename, -1, static_cast<int>(sound_volume), m_continuous);
+        pAudio->Play_Sound(m_filename, -1, static_cast<int>(sound_volume), m_continuous, SOUND_PRIORITY_LOW);
     }
 }
 
@@ -19,11 +19,16 @@
 
 namespace fs = boost::filesystem;
 
+using namespace std;
+
 namespace TSC {
 
 /* *** *** *** *** *** *** *** *** Sound *** *** *** *** *** *** *** *** *** */
 
-cSound::cSound(void) {}
+cSound::cSound(void)
+{
+    m_streamed = 0;
+}
 
 cSound::~cSound(void)
 {
@@ -34,17 +39,106 @@ bool cSound::Load(const fs::path& filename)
 {
     Free();
 
-    if (m_buffer.loadFromFile(path_to_utf8(filename))) {
-        m_filename = filename;
-        return 1;
+    fs::ifstream ifs(filename, ios::in | ios::binary);
+
+    if (!ifs) {
+        return 0;
+    }
+
+    // read the compressed data
+    ifs.seekg(0, ios::end);
+    std::streamoff size = ifs.tellg();
+    ifs.seekg(0, ios::beg);
+
+    if (size <= 0) {
+        return 0;
+    }
+
+    std::vector<char> data(static_cast<size_t>(size));
+
+    if (!ifs.read(&data[0], size)) {
+        return 0;
+    }
+
+    sf::InputSoundFile file;
+
+    if (!file.openFromMemory(&data[0], data.size())) {
+        return 0;
     }
 
-    return 0;
+    // too big to keep decoded
+    if (file.getSampleCount() * sizeof(sf::Int16) > sound_stream_min_size) {
+        m_streamed = 1;
+        m_duration = file.getDuration();
+        m_file_data.swap(data);
+    }
+    // decode all
+    else if (!m_buffer.loadFromMemory(&data[0], data.size())) {
+        return 0;
+    }
+
+    m_filename = filename;
+    return 1;
 }
 
 void cSound::Free(void)
 {
     m_filename.clear();
+
+    m_streamed = 0;
+    std::vector<char>().swap(m_file_data);
+    m_duration = sf::Time::Zero;
+}
+
+sf::Time cSound::Get_Duration(void) const
+{
+    if (m_streamed) {
+        return m_duration;
+    }
+
+    return m_buffer.getDuration();
+}
+
+/* *** *** *** *** *** *** *** *** Sound stream *** *** *** *** *** *** *** *** *** */
+
+cSound_Stream::cSound_Stream(void)
+{
+    //
+}
+
+cSound_Stream::~cSound_Stream(void)
+{
+    // the streaming thread must end before the decoder is destroyed
+    stop();
+}
+
+bool cSound_Stream::Open(const cSound* sound)
+{
+    stop();
+
+    if (!sound->m_streamed || !m_file.openFromMemory(&sound->m_file_data[0], sound->m_file_data.size())) {
+        return 0;
+    }
+
+    // decode 100 ms at once
+    m_samples.resize(m_file.getSampleRate() * m_file.getChannelCount() / 10);
+    initialize(m_file.getChannelCount(), m_file.getSampleRate());
+
+    return 1;
+}
+
+bool cSound_Stream::onGetData(Chunk& data)
+{
+    data.samples = &m_samples[0];
+    data.sampleCount = static_cast<size_t>(m_file.read(&m_samples[0], m_samples.size()));
+
+    // stop if the end is reached
+    return data.sampleCount == m_samples.size();
+}
+
+void cSound_Stream::onSeek(sf::Time time_offset)
+{
+    m_file.seek(time_offset);
 }
 
 
@@ -63,23 +157,23 @@ cSound_Manager::~cSound_Manager(void)
 
 cSound* cSound_Manager::Get_Pointer(const fs::path& path)
 {
-    for (SoundList::const_iterator itr = objects.begin(); itr != objects.end(); ++itr) {
-        cSound* obj = (*itr);
+    std::unordered_map<std::string, cSound*>::const_iterator itr = m_filename_map.find(path.string());
 
-        if (obj->m_filename.compare(path) == 0) {
-            // return first found
-            return obj;
-        }
+    // not found
+    if (itr == m_filename_map.end()) {
+        return NULL;
     }
 
-    // not found
-    return NULL;
+    return itr->second;
 }
 
 void cSound_Manager::Add(cSound* sound)
 {
     m_load_count++;
     cObject_Manager<cSound>::Add(sound);
+
+    // keep the first added for the same path
+    m_filename_map.insert(std::make_pair(sound->m_filename.string(), sound));
 }
 
 void cSound_Manager::Delete_Sounds(void)
@@ -90,6 +184,14 @@ void cSound_Manager::Delete_Sounds(void)
         delete obj;
         obj = NULL;
     }
+
+    m_filename_map.clear();
+}
+
+void cSound_Manager::Delete_All(void)
+{
+    cObject_Manager<cSound>::Delete_All();
+    m_filename_map.clear();
 }
 
 /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
@@ -24,6 +24,11 @@ namespace TSC {
 
     /* *** *** *** *** *** *** *** Sound object *** *** *** *** *** *** *** *** *** *** */
 
+    /* Sounds which need more memory than this when decoded
+     * are kept compressed and decoded while playing
+    */
+    const size_t sound_stream_min_size = 1024 * 1024;
+
     class cSound {
     public:
         cSound(void);
@@ -34,10 +39,48 @@ namespace TSC {
         // Free the data
         void Free(void);
 
+        // Returns the playing duration
+        sf::Time Get_Duration(void) const;
+
         // filename
         boost::filesystem::path m_filename;
-        // data if loaded else null
+        // decoded data if not streamed
         sf::SoundBuffer m_buffer;
+
+        // if it is decoded while playing with cSound_Stream
+        bool m_streamed;
+        // compressed file data if streamed
+        std::vector<char> m_file_data;
+        // playing duration if streamed
+        sf::Time m_duration;
+    };
+
+    /* *** *** *** *** *** *** *** Sound stream *** *** *** *** *** *** *** *** *** *** */
+
+    /* Plays a streamed cSound by decoding it from the compressed data in memory
+     * only a small decoded chunk is kept and SFML queues a few of them
+    */
+    class cSound_Stream : public sf::SoundStream {
+    public:
+        cSound_Stream(void);
+        virtual ~cSound_Stream(void);
+
+        /* Prepare playing the given streamed sound
+         * returns false if the data could not be decoded
+        */
+        bool Open(const cSound* sound);
+
+    protected:
+        // Decode the next chunk
+        virtual bool onGetData(Chunk& data);
+        // Change the decoding position
+        virtual void onSeek(sf::Time time_offset);
+
+    private:
+        // decoder
+        sf::InputSoundFile m_file;
+        // decoded samples
+        std::vector<sf::Int16> m_samples;
     };
 
     typedef vector<cSound*> SoundList;
@@ -75,10 +118,14 @@ namespace TSC {
 
         // Delete all Sounds, but keep object vector entries
         void Delete_Sounds(void);
+        // Delete all Sounds
+        virtual void Delete_All(void);
 
     private:
         // sounds loaded since initialization
         unsigned int m_load_count;
+        // sound filename to sound
+        std::unordered_map<std::string, cSound*> m_filename_map;
     };
 
     /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
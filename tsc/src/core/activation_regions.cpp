@@ -0,0 +1,297 @@
+/***************************************************************************
+ * activation_regions.cpp  -  camera driven sleeping of distant sprites
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../core/activation_regions.hpp"
+#include "../core/game_core.hpp"
+#include "../core/job_system.hpp"
+
+using namespace std;
+
+namespace TSC {
+
+/* *** *** *** *** *** *** cActivation_Region *** *** *** *** *** *** *** *** *** *** *** */
+
+cActivation_Region::cActivation_Region(void)
+{
+    m_x = 0.0f;
+    m_y = 0.0f;
+    m_range_x = 0.0f;
+    m_range_y = 0.0f;
+    m_active = 0;
+}
+
+/* *** *** *** *** *** *** cActivation_Regions *** *** *** *** *** *** *** *** *** *** *** */
+
+const float cActivation_Regions::m_region_size = 512.0f;
+
+// added to the sprite range for images drawn outside of the sprite rect
+static const float activation_margin = 128.0f;
+
+cActivation_Regions::cActivation_Regions(void)
+{
+    m_camera_x = 0.0f;
+    m_camera_y = 0.0f;
+    m_camera_valid = 0;
+    m_enabled = 0;
+    m_dirty = 0;
+    m_lock = 0;
+}
+
+cActivation_Regions::~cActivation_Regions(void)
+{
+    //
+}
+
+void cActivation_Regions::Set_Enabled(bool enable /* = 1 */)
+{
+    m_enabled = enable;
+}
+
+bool cActivation_Regions::Is_Active(void) const
+{
+    // the editor shows and edits all sprites
+    return m_enabled && !editor_enabled;
+}
+
+bool cActivation_Regions::Is_Always_Active(const cSprite* sprite)
+{
+    return sprite->m_always_active || sprite->m_no_camera;
+}
+
+void cActivation_Regions::Add(cSprite* sprite)
+{
+    if (!m_enabled || sprite->m_activation_regions) {
+        return;
+    }
+
+    sprite->m_activation_regions = this;
+    sprite->m_activation_region = NULL;
+    sprite->m_activation_slot = -1;
+
+    Update_Sprite(sprite);
+}
+
+void cActivation_Regions::Remove(cSprite* sprite)
+{
+    if (sprite->m_activation_regions != this) {
+        return;
+    }
+
+    Deactivate(sprite);
+
+    sprite->m_activation_regions = NULL;
+    sprite->m_activation_region = NULL;
+}
+
+void cActivation_Regions::Update_Sprite(cSprite* sprite)
+{
+    // moved by a parallel update
+    if (cJob_System::Is_In_Job()) {
+        cJob_System::Run_Synced(std::bind(&cActivation_Regions::Update_Sprite, this, sprite));
+        return;
+    }
+
+    cActivation_Region* region = Get_Region(sprite);
+    sprite->m_activation_region = region;
+
+    // same as cSprite::Is_In_Range() and cSprite::Is_Visible_On_Screen()
+    const float camera_range = sprite->m_camera_range < 300 ? 0.0f : static_cast<float>(sprite->m_camera_range);
+    const float range_x = max(camera_range, game_res_w * 0.5f) + (sprite->m_rect.m_w * 0.5f) + activation_margin;
+    const float range_y = max(camera_range, game_res_h * 0.5f) + (sprite->m_rect.m_h * 0.5f) + activation_margin;
+
+    if (range_x > region->m_range_x || range_y > region->m_range_y) {
+        region->m_range_x = max(region->m_range_x, range_x);
+        region->m_range_y = max(region->m_range_y, range_y);
+
+        // wake the other sprites of the region with the next rebuild
+        if (!region->m_active && Is_In_Range(region)) {
+            region->m_active = 1;
+            m_dirty = 1;
+        }
+    }
+
+    if (region->m_active || Is_Always_Active(sprite)) {
+        Activate(sprite);
+    }
+    else {
+        Deactivate(sprite);
+    }
+}
+
+void cActivation_Regions::Clear(const cSprite_List& sprites)
+{
+    for (cSprite_List::const_iterator itr = sprites.begin(); itr != sprites.end(); ++itr) {
+        cSprite* sprite = (*itr);
+
+        if (sprite->m_activation_regions != this) {
+            continue;
+        }
+
+        sprite->m_activation_regions = NULL;
+        sprite->m_activation_region = NULL;
+        sprite->m_activation_slot = -1;
+    }
+
+    m_regions.clear();
+    m_active_sprites.clear();
+    m_dirty = 0;
+}
+
+void cActivation_Regions::Update_Camera(float x, float y)
+{
+    if (!m_enabled) {
+        return;
+    }
+
+    m_camera_x = x;
+    m_camera_y = y;
+    m_camera_valid = 1;
+
+    for (RegionMap::iterator itr = m_regions.begin(); itr != m_regions.end(); ++itr) {
+        cActivation_Region& region = itr->second;
+        const bool active = Is_In_Range(&region);
+
+        if (region.m_active != active) {
+            region.m_active = active;
+            m_dirty = 1;
+        }
+    }
+}
+
+cSprite_List& cActivation_Regions::Lock(const cSprite_List& objects)
+{
+    if (m_dirty && !m_lock) {
+        Build(objects);
+    }
+
+    m_lock++;
+    return m_active_sprites;
+}
+
+void cActivation_Regions::Unlock(void)
+{
+    if (m_lock) {
+        m_lock--;
+    }
+}
+
+bool cActivation_Regions::Is_In_Range(const cActivation_Region* region) const
+{
+    // no camera yet
+    if (!m_camera_valid) {
+        return 0;
+    }
+
+    const float camera_center_x = m_camera_x + (game_res_w * 0.5f);
+    const float camera_center_y = m_camera_y + (game_res_h * 0.5f);
+
+    if (camera_center_x < region->m_x - region->m_range_x ||
+            camera_center_y < region->m_y - region->m_range_y ||
+            camera_center_x > region->m_x + m_region_size + region->m_range_x ||
+            camera_center_y > region->m_y + m_region_size + region->m_range_y) {
+        return 0;
+    }
+
+    return 1;
+}
+
+cActivation_Region* cActivation_Regions::Get_Region(const cSprite* sprite)
+{
+    // the rect is at the start position in the editor
+    const int x = static_cast<int>(floor((sprite->m_pos_x + (sprite->m_rect.m_w * 0.5f)) / m_region_size));
+    const int y = static_cast<int>(floor((sprite->m_pos_y + (sprite->m_rect.m_h * 0.5f)) / m_region_size));
+
+    cActivation_Region* region = sprite->m_activation_region;
+
+    // still in the same region
+    if (region && Is_Float_Equal(region->m_x, x * m_region_size) && Is_Float_Equal(region->m_y, y * m_region_size)) {
+        return region;
+    }
+
+    RegionMap::iterator itr = m_regions.find(std::make_pair(x, y));
+
+    if (itr != m_regions.end()) {
+        return &itr->second;
+    }
+
+    region = &m_regions[std::make_pair(x, y)];
+    region->m_x = x * m_region_size;
+    region->m_y = y * m_region_size;
+
+    return region;
+}
+
+void cActivation_Regions::Activate(cSprite* sprite)
+{
+    // already active
+    if (sprite->m_activation_slot >= 0) {
+        return;
+    }
+
+    sprite->m_activation_slot = m_active_sprites.size();
+    m_active_sprites.push_back(sprite);
+    // not updated while asleep
+    sprite->Update_Valid_Draw();
+}
+
+void cActivation_Regions::Deactivate(cSprite* sprite)
+{
+    const int slot = sprite->m_activation_slot;
+
+    // not active
+    if (slot < 0) {
+        return;
+    }
+
+    if (static_cast<size_t>(slot) < m_active_sprites.size() && m_active_sprites[slot] == sprite) {
+        m_active_sprites[slot] = NULL;
+    }
+
+    sprite->m_activation_slot = -1;
+    // remove the empty entry
+    m_dirty = 1;
+}
+
+void cActivation_Regions::Build(const cSprite_List& objects)
+{
+    m_active_sprites.clear();
+
+    for (cSprite_List::const_iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+        cSprite* sprite = (*itr);
+
+        if (sprite->m_activation_regions != this) {
+            continue;
+        }
+
+        if (!Is_Always_Active(sprite) && !(sprite->m_activation_region && sprite->m_activation_region->m_active)) {
+            sprite->m_activation_slot = -1;
+            continue;
+        }
+
+        // woke up
+        if (sprite->m_activation_slot < 0) {
+            sprite->Update_Valid_Draw();
+        }
+
+        sprite->m_activation_slot = m_active_sprites.size();
+        m_active_sprites.push_back(sprite);
+    }
+
+    m_dirty = 0;
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
@@ -0,0 +1,126 @@
+/***************************************************************************
+ * activation_regions.hpp
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_ACTIVATION_REGIONS_HPP
+#define TSC_ACTIVATION_REGIONS_HPP
+
+#include "../core/global_basic.hpp"
+#include "../objects/sprite.hpp"
+
+namespace TSC {
+
+    /* *** *** *** *** *** cActivation_Region *** *** *** *** *** *** *** *** *** *** *** *** */
+
+    class cActivation_Region {
+    public:
+        cActivation_Region(void);
+
+        // region position in level pixels
+        float m_x;
+        float m_y;
+        /* biggest distance from the camera center to a sprite of this region
+         * at which the sprite still needs to be updated
+        */
+        float m_range_x;
+        float m_range_y;
+        // if the sprites of this region are updated and drawn
+        bool m_active;
+    };
+
+    /* *** *** *** *** *** cActivation_Regions *** *** *** *** *** *** *** *** *** *** *** *** */
+
+    /* Keeps the sprites of a sprite manager asleep while the camera is far away
+     * The sprites are sorted into regions of the level. A region is activated
+     * when the camera gets close enough for one of its sprites to be in camera
+     * range or visible and only the sprites of active regions are updated and
+     * drawn. Sprites which have to run everywhere, like particle emitters or
+     * moving platforms carrying something out of sight, set m_always_active.
+     * The sprites stay in the sprite manager for collision, saving, scripting
+     * and the editor. While the editor is enabled all sprites are used.
+    */
+    class cActivation_Regions {
+    public:
+        cActivation_Regions(void);
+        ~cActivation_Regions(void);
+
+        /* Enable sorting the sprites into regions
+         * must be set before sprites are added
+        */
+        void Set_Enabled(bool enable = 1);
+        // returns true if only the sprites of the active regions are used
+        bool Is_Active(void) const;
+
+        // Add the sprite to the region of its position
+        void Add(cSprite* sprite);
+        // Remove the sprite
+        void Remove(cSprite* sprite);
+        // Move the sprite to the region of its position and wake or sleep it
+        void Update_Sprite(cSprite* sprite);
+        // Remove all given sprites and regions
+        void Clear(const cSprite_List& sprites);
+
+        // Activate the regions in range of the given camera position
+        void Update_Camera(float x, float y);
+
+        // rebuild the active sprites before the next use
+        inline void Set_Dirty(void)
+        {
+            m_dirty = 1;
+        };
+
+        /* Return the sprites of the active regions in the order of the given objects
+         * the list is rebuilt if dirty and not locked. Sprites added while
+         * locked are appended and removed ones are set to NULL.
+        */
+        cSprite_List& Lock(const cSprite_List& objects);
+        // allow rebuilding the active sprites again
+        void Unlock(void);
+
+        // region size in level pixels
+        static const float m_region_size;
+    private:
+        typedef std::map<std::pair<int, int>, cActivation_Region> RegionMap;
+
+        // returns true if the sprite is used even if its region is asleep
+        static bool Is_Always_Active(const cSprite* sprite);
+        // returns true if the region is in range of the camera
+        bool Is_In_Range(const cActivation_Region* region) const;
+        // Return the region of the sprite position
+        cActivation_Region* Get_Region(const cSprite* sprite);
+
+        // Add to the active sprites
+        void Activate(cSprite* sprite);
+        // Remove from the active sprites
+        void Deactivate(cSprite* sprite);
+        // collect the sprites of the active regions
+        void Build(const cSprite_List& objects);
+
+        RegionMap m_regions;
+        cSprite_List m_active_sprites;
+        // last camera position
+        float m_camera_x;
+        float m_camera_y;
+        bool m_camera_valid;
+        bool m_enabled;
+        bool m_dirty;
+        // nested users of the active sprites
+        unsigned int m_lock;
+    };
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
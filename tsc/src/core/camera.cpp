@@ -390,12 +390,16 @@ void cCamera::Update_Position(void) const
     if (Game_Mode == MODE_LEVEL || Game_Mode == MODE_OVERWORLD) {
         // update player
         pActive_Player->Update_Valid_Draw();
+        // wake the sprites near the camera
+        m_sprite_manager->m_activation_regions.Update_Camera(m_x, m_y);
         // update sprite manager
         m_sprite_manager->Update_Items_Valid_Draw();
     }
     else if (Game_Mode == MODE_MENU) {
         // update player
         pActive_Player->Update_Valid_Draw();
+        // wake the sprites near the camera
+        m_sprite_manager->m_activation_regions.Update_Camera(m_x, m_y);
         // update sprite manager
         m_sprite_manager->Update_Items_Valid_Draw();
     }
@@ -24,17 +24,108 @@
 
 namespace TSC {
 
+/* *** *** *** *** *** *** *** Collision memory *** *** *** *** *** *** *** *** *** *** */
+
+/* The free lists and the counter are kept per thread as sprites may be
+ * updated on the job system workers. Memory released on another thread
+ * than it was allocated on is simply reused by that thread.
+*/
+
+// heap allocations of this thread since the last Take_Collision_Allocation_Count
+static thread_local uint32_t collision_allocation_count = 0;
+
+/* Free memory blocks of one size
+ * never freed as collisions are created until the thread exits
+*/
+class cCollision_Free_List {
+public:
+    void* Allocate(size_t size)
+    {
+        if (m_blocks.empty()) {
+            collision_allocation_count++;
+            return ::operator new(size);
+        }
+
+        void* ptr = m_blocks.back();
+        m_blocks.pop_back();
+        return ptr;
+    }
+
+    void Release(void* ptr)
+    {
+        if (!ptr) {
+            return;
+        }
+
+        m_blocks.push_back(ptr);
+    }
+
+private:
+    vector<void*> m_blocks;
+};
+
+static cCollision_Free_List& Get_Collision_Free_List(void)
+{
+    // allocated once to be usable during static destruction
+    static thread_local cCollision_Free_List* free_list = new cCollision_Free_List();
+    return *free_list;
+}
+
+static cCollision_Free_List& Get_Collision_Type_Free_List(void)
+{
+    static thread_local cCollision_Free_List* free_list = new cCollision_Free_List();
+    return *free_list;
+}
+
+// storage of the objects vector of deleted collision lists
+static vector<cObjectCollision_List>& Get_Collision_List_Storage(void)
+{
+    static thread_local vector<cObjectCollision_List>* storage = new vector<cObjectCollision_List>();
+    return *storage;
+}
+
+uint32_t Take_Collision_Allocation_Count(void)
+{
+    const uint32_t count = collision_allocation_count;
+    collision_allocation_count = 0;
+    return count;
+}
+
 /* *** *** *** *** *** *** *** cObjectCollisionType *** *** *** *** *** *** *** *** *** *** */
 
 cObjectCollisionType::cObjectCollisionType(void)
     : cObject_Manager<cObjectCollision>()
 {
+    vector<cObjectCollision_List>& storage = Get_Collision_List_Storage();
 
+    // reuse the storage of a deleted list
+    if (!storage.empty()) {
+        objects.swap(storage.back());
+        storage.pop_back();
+    }
 }
 
 cObjectCollisionType::~cObjectCollisionType(void)
 {
     Delete_All();
+
+    // keep the storage for the next list
+    if (objects.capacity()) {
+        vector<cObjectCollision_List>& storage = Get_Collision_List_Storage();
+
+        storage.push_back(cObjectCollision_List());
+        storage.back().swap(objects);
+    }
+}
+
+void* cObjectCollisionType::operator new(size_t size)
+{
+    return Get_Collision_Type_Free_List().Allocate(size);
+}
+
+void cObjectCollisionType::operator delete(void* ptr)
+{
+    Get_Collision_Type_Free_List().Release(ptr);
 }
 
 void cObjectCollisionType::Add(cObjectCollision* obj)
@@ -43,6 +134,11 @@ void cObjectCollisionType::Add(cObjectCollision* obj)
         return;
     }
 
+    // storage grows
+    if (objects.size() == objects.capacity()) {
+        collision_allocation_count++;
+    }
+
     cObject_Manager<cObjectCollision>::Add(obj);
 }
 
@@ -121,6 +217,16 @@ cObjectCollision::~cObjectCollision(void)
     //
 }
 
+void* cObjectCollision::operator new(size_t size)
+{
+    return Get_Collision_Free_List().Allocate(size);
+}
+
+void cObjectCollision::operator delete(void* ptr)
+{
+    Get_Collision_Free_List().Release(ptr);
+}
+
 void cObjectCollision::Set_Direction(const cSprite* base, const cSprite* col)
 {
     m_direction = Get_Collision_Direction(base, col);
@@ -35,6 +35,10 @@ namespace TSC {
         cObjectCollision(void);
         ~cObjectCollision(void);
 
+        // collisions are created and deleted every frame so their memory is reused
+        static void* operator new(size_t size);
+        static void operator delete(void* ptr);
+
         /* Set the collision direction
          * base - the base sprite
          * col - the colliding sprite
@@ -67,9 +71,15 @@ namespace TSC {
 // collision type class
     class cObjectCollisionType : public cObject_Manager<cObjectCollision> {
     public:
+        /* the list memory and the storage of the objects vector are reused
+         * from previously deleted lists
+        */
         cObjectCollisionType(void);
         virtual ~cObjectCollisionType(void);
 
+        static void* operator new(size_t size);
+        static void operator delete(void* ptr);
+
         // Add an object collision
         virtual void Add(cObjectCollision* obj);
 
@@ -90,6 +100,11 @@ namespace TSC {
 
     /* *** *** *** *** *** *** *** functions *** *** *** *** *** *** *** *** *** *** */
 
+    /* Returns the heap allocations done for collision data by the calling
+     * thread since the last call and resets the count
+    */
+    uint32_t Take_Collision_Allocation_Count(void);
+
     /* Returns the collision direction
      * base - the base sprite
      * col - the colliding sprite
@@ -18,6 +18,7 @@
 #include "game_core.hpp"
 #include "../core/framerate.hpp"
 #include "../core/math/utilities.hpp"
+#include "../core/collision.hpp"
 
 namespace TSC {
 
@@ -76,6 +77,18 @@ cFramerate::cFramerate(void)
     m_speed_factor = 0.1f;
     m_force_speed_factor = 0.0f;
     m_perf_last_ticks = 0;
+    m_perf_collision_allocations = 0;
+    m_perf_script_gc_time = 0;
+    m_perf_script_gc_steps = 0;
+    m_perf_script_gc_live = 0;
+    m_perf_script_gc_pages = 0;
+    m_perf_render_main_time = 0;
+    m_perf_render_thread_time = 0;
+    m_perf_render_wait_time = 0;
+    m_perf_render_frames = 0;
+    m_perf_render_main_sum = 0;
+    m_perf_render_thread_sum = 0;
+    m_perf_render_wait_sum = 0;
 
     // create performance timers
     for (unsigned int i = 0; i < 24; i++) {
@@ -158,6 +171,9 @@ void cFramerate::Update(void)
         m_fps_worst = m_fps;
     }
 
+    // collision data should be allocation free once warmed up
+    m_perf_collision_allocations = Take_Collision_Allocation_Count();
+
     m_last_ticks = current_ticks;
 }
 
@@ -188,6 +204,26 @@ void cFramerate::Set_Fixed_Speedfacor(const float val)
     m_force_speed_factor = val;
 }
 
+void cFramerate::Update_Render_Time(uint32_t main_time, uint32_t thread_time, uint32_t wait_time)
+{
+    m_perf_render_frames++;
+    m_perf_render_main_sum += main_time;
+    m_perf_render_thread_sum += thread_time;
+    m_perf_render_wait_sum += wait_time;
+
+    // counted 100 frames
+    if (m_perf_render_frames >= 100) {
+        m_perf_render_main_time = static_cast<uint32_t>(m_perf_render_main_sum / m_perf_render_frames);
+        m_perf_render_thread_time = static_cast<uint32_t>(m_perf_render_thread_sum / m_perf_render_frames);
+        m_perf_render_wait_time = static_cast<uint32_t>(m_perf_render_wait_sum / m_perf_render_frames);
+
+        m_perf_render_frames = 0;
+        m_perf_render_main_sum = 0;
+        m_perf_render_thread_sum = 0;
+        m_perf_render_wait_sum = 0;
+    }
+}
+
 /* *** *** *** *** *** *** *** helper functions *** *** *** *** *** *** *** *** *** *** */
 
 void Correct_Frame_Time(const unsigned int fps)
@@ -69,6 +69,13 @@ namespace TSC {
         */
         void Set_Fixed_Speedfacor(const float val);
 
+        /* Add the render times of a frame in microseconds
+         * main_time : spent in rendering by the main thread including waiting
+         * thread_time : spent by the render thread
+         * wait_time : the main thread waited for the render thread
+        */
+        void Update_Render_Time(uint32_t main_time, uint32_t thread_time, uint32_t wait_time);
+
         // target fps for speed factor calculations
         float m_fps_target;
         // current fps
@@ -103,6 +110,29 @@ namespace TSC {
         // ## performance values ##
         // ticks since last section
         uint32_t m_perf_last_ticks;
+        // heap allocations for collision data in the last frame
+        uint32_t m_perf_collision_allocations;
+        // mruby garbage collection of the last level frame
+        // time spent in microseconds
+        uint32_t m_perf_script_gc_time;
+        // incremental steps run
+        uint32_t m_perf_script_gc_steps;
+        // live objects
+        uint32_t m_perf_script_gc_live;
+        // heap pages
+        uint32_t m_perf_script_gc_pages;
+        // rendering times in microseconds averaged over 100 frames
+        // main thread including waiting for the render thread
+        uint32_t m_perf_render_main_time;
+        // render thread
+        uint32_t m_perf_render_thread_time;
+        // main thread waiting for the render thread
+        uint32_t m_perf_render_wait_time;
+        // frames and sums of the current average
+        uint32_t m_perf_render_frames;
+        uint64_t m_perf_render_main_sum;
+        uint64_t m_perf_render_thread_sum;
+        uint64_t m_perf_render_wait_sum;
 
         typedef vector<cPerformance_Timer*> Performance_Timer_List;
         Performance_Timer_List m_perf_timer;
@@ -22,11 +22,6 @@
 #define _WIN32_IE 0x0500
 #endif
 
-/* uncomment to enable experimental rendering in a thread
-* still randomly crashes because gl functions are called while the render thread is active
-*/
-//#define TSC_RENDER_THREAD_TEST
-
 /* *** *** *** *** *** *** *** Debugging *** *** *** *** *** *** *** *** *** *** */
 
 #if defined(_MSC_VER) && defined(_DEBUG)
@@ -180,6 +180,7 @@ namespace TSC {
 #define USER_WORLD_DIR "worlds"
 #define USER_CAMPAIGN_DIR "campaigns"
 #define USER_IMGCACHE_DIR "images"
+#define USER_SCRIPTCACHE_DIR "scripts"
 #define USER_SCRIPTING_DIR "scripting"
 
     /* *** *** *** *** *** *** *** forward declarations *** *** *** *** *** *** *** *** *** *** */
@@ -408,12 +409,15 @@ namespace TSC {
 
     /* *** Classes *** */
 
+    class cActivation_Region;
+    class cActivation_Regions;
     class cCamera;
     class cCircle_Request;
     class cEditor_Object_Settings_Item;
     class cGL_Surface;
     class cGradient_Request;
     class cImage_Settings_Data;
+    class cImage_Settings_Parser;
     class cLayer_Line_Point_Start;
     class cLevel;
     class cLine_collision;
@@ -434,6 +438,7 @@ namespace TSC {
     class cSize_Float;
     class cSize_Int;
     class cSprite_Manager;
+    class cStatic_Sprite_Layer;
     class cSurface_Request;
     class cSprite;
     class cBackground_Manager;
@@ -0,0 +1,112 @@
+/***************************************************************************
+ * interned_string.cpp  -  shared storage for repeated strings
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../core/interned_string.hpp"
+#include <unordered_set>
+#include <boost/thread/mutex.hpp>
+
+using namespace std;
+
+namespace TSC {
+
+/* *** *** *** *** *** *** cInterned_String *** *** *** *** *** *** *** *** *** *** *** */
+
+typedef std::unordered_set<std::string> InternedStringSet;
+
+// allocated once to be usable during static initialization and destruction
+static InternedStringSet& Get_Interned_Strings(void)
+{
+    static InternedStringSet* strings = new InternedStringSet();
+    return *strings;
+}
+
+static boost::mutex& Get_Interned_Strings_Mutex(void)
+{
+    static boost::mutex* mutex = new boost::mutex();
+    return *mutex;
+}
+
+static const std::string* Insert_Interned_String(const std::string& str)
+{
+    boost::lock_guard<boost::mutex> lock(Get_Interned_Strings_Mutex());
+    // elements of an unordered_set are not moved on rehash
+    return &*Get_Interned_Strings().insert(str).first;
+}
+
+// the empty string is used by most objects
+static const std::string* Get_Empty_Interned_String(void)
+{
+    static const std::string* empty = Insert_Interned_String(std::string());
+    return empty;
+}
+
+cInterned_String::cInterned_String(void)
+    : m_string(Get_Empty_Interned_String())
+{
+
+}
+
+cInterned_String::cInterned_String(const std::string& str)
+    : m_string(Intern(str))
+{
+
+}
+
+cInterned_String::cInterned_String(const char* str)
+    : m_string(Intern(str))
+{
+
+}
+
+cInterned_String& cInterned_String::operator=(const std::string& str)
+{
+    m_string = Intern(str);
+    return *this;
+}
+
+cInterned_String& cInterned_String::operator=(const char* str)
+{
+    m_string = Intern(str);
+    return *this;
+}
+
+const std::string* cInterned_String::Intern(const std::string& str)
+{
+    if (str.empty()) {
+        return Get_Empty_Interned_String();
+    }
+
+    return Insert_Interned_String(str);
+}
+
+size_t cInterned_String::Get_Pool_Size(size_t* memory /* = NULL */)
+{
+    boost::lock_guard<boost::mutex> lock(Get_Interned_Strings_Mutex());
+    const InternedStringSet& strings = Get_Interned_Strings();
+
+    if (memory) {
+        *memory = 0;
+
+        for (InternedStringSet::const_iterator itr = strings.begin(); itr != strings.end(); ++itr) {
+            *memory += sizeof(std::string) + itr->capacity();
+        }
+    }
+
+    return strings.size();
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
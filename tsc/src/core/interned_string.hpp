@@ -0,0 +1,83 @@
+/***************************************************************************
+ * interned_string.hpp
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_INTERNED_STRING_HPP
+#define TSC_INTERNED_STRING_HPP
+
+#include "../core/global_basic.hpp"
+
+namespace TSC {
+
+    /* *** *** *** *** *** cInterned_String *** *** *** *** *** *** *** *** *** *** *** *** */
+
+    /* Pointer to a shared string stored only once for the whole game
+     * Meant for strings repeated by many objects like image filenames and
+     * editor tags. Interned strings are never freed.
+    */
+    class cInterned_String {
+    public:
+        cInterned_String(void);
+        cInterned_String(const std::string& str);
+        cInterned_String(const char* str);
+
+        cInterned_String& operator=(const std::string& str);
+        cInterned_String& operator=(const char* str);
+
+        inline const std::string& str(void) const
+        {
+            return *m_string;
+        };
+        inline operator const std::string& (void) const
+        {
+            return *m_string;
+        };
+        inline const char* c_str(void) const
+        {
+            return m_string->c_str();
+        };
+        inline bool empty(void) const
+        {
+            return m_string->empty();
+        };
+
+        // equal strings share the same storage
+        inline bool operator==(const cInterned_String& other) const
+        {
+            return m_string == other.m_string;
+        };
+        inline bool operator!=(const cInterned_String& other) const
+        {
+            return m_string != other.m_string;
+        };
+
+        // Return the number of different strings and the memory used by them
+        static size_t Get_Pool_Size(size_t* memory = NULL);
+    private:
+        // return the shared copy of the string
+        static const std::string* Intern(const std::string& str);
+
+        const std::string* m_string;
+    };
+
+    inline std::ostream& operator<<(std::ostream& stream, const cInterned_String& str)
+    {
+        return stream << str.str();
+    }
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
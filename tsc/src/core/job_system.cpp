@@ -0,0 +1,229 @@
+/***************************************************************************
+ * job_system.cpp  -  work stealing thread pool for parallel updates
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../core/job_system.hpp"
+
+using namespace std;
+
+namespace TSC {
+
+/* *** *** *** *** *** *** cJob_System *** *** *** *** *** *** *** *** *** *** *** */
+
+// synced functions of the batch running on this thread or NULL if not in a batch
+static thread_local vector<std::function<void()> >* current_synced = NULL;
+
+cJob_System::cJob_System(unsigned int threads /* = 0 */)
+{
+    m_generation = 0;
+    m_pending = 0;
+    m_quit = 0;
+    m_func = NULL;
+
+    if (!threads) {
+        // the calling thread works as well
+        threads = boost::thread::hardware_concurrency();
+        threads = threads > 1 ? std::min(threads - 1, 4u) : 0;
+    }
+
+    // queue of the calling thread
+    m_queues.push_back(new cQueue());
+
+    for (unsigned int i = 0; i < threads; i++) {
+        m_queues.push_back(new cQueue());
+        m_threads.add_thread(new boost::thread(&cJob_System::Worker, this, i + 1));
+    }
+}
+
+cJob_System::~cJob_System(void)
+{
+    {
+        boost::lock_guard<boost::mutex> lock(m_mutex);
+        m_quit = 1;
+    }
+
+    m_work_condition.notify_all();
+    m_threads.join_all();
+
+    for (vector<cQueue*>::iterator itr = m_queues.begin(); itr != m_queues.end(); ++itr) {
+        delete (*itr);
+    }
+
+    m_queues.clear();
+}
+
+void cJob_System::Run(size_t count, size_t batch_size, const Batch_Func& func)
+{
+    if (!count) {
+        return;
+    }
+
+    if (!batch_size) {
+        batch_size = 1;
+    }
+
+    const size_t batches = (count + batch_size - 1) / batch_size;
+
+    // not worth it or nested
+    if (m_queues.size() == 1 || batches == 1 || Is_In_Job()) {
+        func(0, count);
+        return;
+    }
+
+    m_func = &func;
+    m_synced.assign(batches, Synced_List());
+
+    {
+        boost::lock_guard<boost::mutex> lock(m_mutex);
+        m_pending = batches;
+    }
+
+    // spread the batches over all queues
+    for (size_t i = 0; i < batches; i++) {
+        cJob job;
+        job.m_num = i;
+        job.m_begin = i * batch_size;
+        job.m_end = std::min(count, job.m_begin + batch_size);
+
+        cQueue* queue = m_queues[i % m_queues.size()];
+        boost::lock_guard<boost::mutex> lock(queue->m_mutex);
+        queue->m_jobs.push_back(job);
+    }
+
+    {
+        boost::lock_guard<boost::mutex> lock(m_mutex);
+        m_generation++;
+    }
+
+    m_work_condition.notify_all();
+
+    // work as well
+    Run_Jobs(0);
+
+    {
+        boost::unique_lock<boost::mutex> lock(m_mutex);
+
+        while (m_pending) {
+            m_done_condition.wait(lock);
+        }
+    }
+
+    m_func = NULL;
+
+    // apply the side effects in batch order
+    for (vector<Synced_List>::iterator itr = m_synced.begin(); itr != m_synced.end(); ++itr) {
+        for (Synced_List::iterator func_itr = itr->begin(); func_itr != itr->end(); ++func_itr) {
+            (*func_itr)();
+        }
+    }
+
+    m_synced.clear();
+}
+
+bool cJob_System::Is_In_Job(void)
+{
+    return current_synced != NULL;
+}
+
+void cJob_System::Run_Synced(const std::function<void()>& func)
+{
+    if (!current_synced) {
+        func();
+        return;
+    }
+
+    current_synced->push_back(func);
+}
+
+unsigned int cJob_System::Get_Thread_Count(void) const
+{
+    return m_queues.size();
+}
+
+void cJob_System::Worker(unsigned int num)
+{
+    unsigned int generation = 0;
+
+    while (1) {
+        {
+            boost::unique_lock<boost::mutex> lock(m_mutex);
+
+            while (!m_quit && generation == m_generation) {
+                m_work_condition.wait(lock);
+            }
+
+            if (m_quit) {
+                return;
+            }
+
+            generation = m_generation;
+        }
+
+        Run_Jobs(num);
+    }
+}
+
+bool cJob_System::Take_Job(unsigned int num, cJob& job)
+{
+    // newest of the own queue
+    {
+        cQueue* queue = m_queues[num];
+        boost::lock_guard<boost::mutex> lock(queue->m_mutex);
+
+        if (!queue->m_jobs.empty()) {
+            job = queue->m_jobs.back();
+            queue->m_jobs.pop_back();
+            return 1;
+        }
+    }
+
+    // steal the oldest of another queue
+    for (size_t i = 1; i < m_queues.size(); i++) {
+        cQueue* queue = m_queues[(num + i) % m_queues.size()];
+        boost::lock_guard<boost::mutex> lock(queue->m_mutex);
+
+        if (!queue->m_jobs.empty()) {
+            job = queue->m_jobs.front();
+            queue->m_jobs.pop_front();
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+void cJob_System::Run_Jobs(unsigned int num)
+{
+    cJob job;
+
+    while (Take_Job(num, job)) {
+        current_synced = &m_synced[job.m_num];
+        (*m_func)(job.m_begin, job.m_end);
+        current_synced = NULL;
+
+        boost::lock_guard<boost::mutex> lock(m_mutex);
+
+        if (!--m_pending) {
+            m_done_condition.notify_all();
+        }
+    }
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+cJob_System* pJob_System = NULL;
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
@@ -0,0 +1,120 @@
+/***************************************************************************
+ * job_system.hpp
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_JOB_SYSTEM_HPP
+#define TSC_JOB_SYSTEM_HPP
+
+#include "../core/global_basic.hpp"
+#include <deque>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+
+namespace TSC {
+
+    /* *** *** *** *** *** cJob_System *** *** *** *** *** *** *** *** *** *** *** *** */
+
+    /* Runs independent work split into batches on worker threads
+     * Every thread has its own queue. A thread takes batches from the back of
+     * its own queue and steals from the front of the other queues when it
+     * runs empty. The calling thread works as well and Run() returns when all
+     * batches are done.
+     * Changes to shared game state like playing sounds, adding sprites or
+     * firing script events must not happen inside a batch. They are passed to
+     * Run_Synced() which keeps them in a buffer of the batch and runs all
+     * buffers in batch order after the last batch finished. The result does
+     * not depend on which thread ran which batch.
+    */
+    class cJob_System {
+    public:
+        // batch function getting the first and one past the last item
+        typedef std::function<void(size_t, size_t)> Batch_Func;
+
+        /* Create the worker threads
+         * if threads is 0 the count is based on the available cores
+        */
+        cJob_System(unsigned int threads = 0);
+        ~cJob_System(void);
+
+        /* Run the function for all items split into batches of the given size
+         * Returns after all batches and their synced functions are done.
+         * Runs on the calling thread only if called from inside a batch.
+        */
+        void Run(size_t count, size_t batch_size, const Batch_Func& func);
+
+        // returns true if called from inside a batch
+        static bool Is_In_Job(void);
+        /* Run the function now or if called from inside a batch
+         * after all batches are done
+        */
+        static void Run_Synced(const std::function<void()>& func);
+
+        // Return the number of threads working on a Run() including the caller
+        unsigned int Get_Thread_Count(void) const;
+    private:
+        typedef std::vector<std::function<void()> > Synced_List;
+
+        class cJob {
+        public:
+            // batch number
+            size_t m_num;
+            // item range
+            size_t m_begin;
+            size_t m_end;
+        };
+
+        class cQueue {
+        public:
+            std::deque<cJob> m_jobs;
+            boost::mutex m_mutex;
+        };
+
+        // worker thread function
+        void Worker(unsigned int num);
+        // take the next job of the given thread queue or steal one
+        bool Take_Job(unsigned int num, cJob& job);
+        // run all jobs available to the given thread queue
+        void Run_Jobs(unsigned int num);
+
+        // the first queue belongs to the thread calling Run()
+        std::vector<cQueue*> m_queues;
+        boost::thread_group m_threads;
+
+        boost::mutex m_mutex;
+        // workers wait for new jobs
+        boost::condition_variable m_work_condition;
+        // Run() waits for the last job
+        boost::condition_variable m_done_condition;
+        // increased with every Run()
+        unsigned int m_generation;
+        // unfinished jobs of the current Run()
+        size_t m_pending;
+        bool m_quit;
+
+        // function of the current Run()
+        const Batch_Func* m_func;
+        // synced functions of each batch
+        std::vector<Synced_List> m_synced;
+    };
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+// Job System class
+    extern cJob_System* pJob_System;
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
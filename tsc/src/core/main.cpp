@@ -29,6 +29,7 @@
 #include "sprite_manager.hpp"
 #include "../level/level_settings.hpp"
 #include "../level/level_editor.hpp"
+#include "../level/level_preloader.hpp"
 #include "../overworld/world_editor.hpp"
 #include "../input/joystick.hpp"
 #include "../overworld/world_manager.hpp"
@@ -45,201 +46,12 @@
 #include "../gui/generic.hpp"
 #include "../gui/game_console.hpp"
 #include "../gui/debug_window.hpp"
+#include "../core/job_system.hpp"
 
 using namespace std;
 
-// TSC namespace is set later to exclude main() from it
-using namespace TSC;
-
 /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
 
-int main(int argc, char** argv)
-{
-// todo : remove this apple hack
-#ifdef __APPLE__
-    // dynamic datapath detection for OS X
-    // change CWD to point inside bundle so it finds its data (if necessary)
-    char path[1024];
-    CFBundleRef mainBundle = CFBundleGetMainBundle();
-    assert(mainBundle);
-    CFURLRef mainBundleURL = CFBundleCopyBundleURL(mainBundle);
-    assert(mainBundleURL);
-    CFStringRef cfStringRef = CFURLCopyFileSystemPath(mainBundleURL, kCFURLPOSIXPathStyle);
-    assert(cfStringRef);
-    CFStringGetCString(cfStringRef, path, 1024, kCFStringEncodingASCII);
-    CFRelease(mainBundleURL);
-    CFRelease(cfStringRef);
-
-    std::string contents = std::string(path) + std::string("/Contents");
-    std::string datapath;
-
-    if (contents.find(".app") != std::string::npos) {
-        // executable is inside an app bundle, use app bundle-relative paths
-        datapath = contents + std::string("/Resources/data/");
-    }
-    else if (contents.find("/bin") != std::string::npos) {
-        // executable is installed Unix-way
-        datapath = contents.substr(0, contents.find("/bin")) + "/share/tsc";
-    }
-    else {
-        cerr << "Warning: Could not determine installation type\n";
-    }
-
-    if (!datapath.empty()) {
-        cout << "setting CWD to " << datapath.c_str() << endl;
-        if (chdir(datapath.c_str()) != 0) {
-            cerr << "Warning: Failed changing CWD\n";
-        }
-    }
-#endif
-
-    // convert arguments to a vector string
-    vector<std::string> arguments(argv, argv + argc);
-
-    if (argc >= 2) {
-        for (unsigned int i = 1; i < arguments.size(); i++) {
-            // help
-            if (arguments[i] == "--help" || arguments[i] == "-h") {
-                cout << "Usage: " << arguments[0] << " [OPTIONS]" << endl;
-                cout << "Where OPTIONS is one of the following:" << endl;
-                cout << "-h, --help\tDisplay this message" << endl;
-                cout << "-v, --version\tShow the version of " << CAPTION << endl;
-                cout << "-d, --debug\tEnable debug modes with the options : game performance" << endl;
-                cout << "-l, --level\tLoad the given level" << endl;
-                cout << "-w, --world\tLoad the given world" << endl;
-                return EXIT_SUCCESS;
-            }
-            // version
-            else if (arguments[i] == "--version" || arguments[i] == "-v") {
-                std::cout << "This is " << CAPTION << " version " << TSC_VERSION_MAJOR << "." << TSC_VERSION_MINOR << "." << TSC_VERSION_PATCH;
-#ifdef TSC_VERSION_POSTFIX
-                std::cout << "-" << TSC_VERSION_POSTFIX << "." << std::endl;
-                std::cout << " --- This is a DEVELOPMENT built! It may eat your hamster! ---" << std::endl;
-#else
-                std::cout << "." << std::endl;
-#endif
-#ifdef TSC_VERSION_GIT
-                std::cout << "It was compiled from commit " << TSC_VERSION_GIT << "." << std::endl;
-#endif
-                return EXIT_SUCCESS;
-            }
-            // debug
-            else if (arguments[i] == "--debug" || arguments[i] == "-d") {
-                // no value
-                if (i + 1 >= arguments.size()) {
-                    cerr << arguments[i] << " requires a value" << endl;
-                    return EXIT_FAILURE;
-                }
-                // with value
-                else {
-                    for (unsigned int option = i + i; i < arguments.size(); i++) {
-                        std::string option_str = arguments[option];
-
-                        if (option_str == "game") {
-                            game_debug = 1;
-                        }
-                        else if (option_str == "performance") {
-                            game_debug_performance = 1;
-                        }
-                        else {
-                            cerr << "Unknown debug option " << option_str << endl;
-                            return EXIT_FAILURE;
-                        }
-                    }
-                }
-            }
-            // level loading is handled later
-            else if (arguments[i] == "--level" || arguments[i] == "-l") {
-                // skip
-            }
-            // world loading is handled later
-            else if (arguments[1] == "--world" || arguments[1] == "-w") {
-                // skip
-            }
-            // unknown argument
-            else if (arguments[i].substr(0, 1) == "-") {
-                cerr << "Unknown argument " << arguments[i] << endl << "Use -h to list all possible arguments" << endl;
-                return EXIT_FAILURE;
-            }
-        }
-    }
-
-    do {
-        game_reset = false;
-        game_exit = false;
-
-        // initialize everything
-        Init_Game();
-
-        // command line level entering
-        if (argc > 2 && (arguments[1] == "--level" || arguments[1] == "-l") && !arguments[2].empty()) {
-            Game_Action = GA_ENTER_LEVEL;
-            Game_Mode_Type = MODE_TYPE_LEVEL_CUSTOM;
-            Game_Action_Data_Middle.add("load_level", arguments[2]);
-        }
-        // command line world entering
-        else if (argc > 2 && (arguments[1] == "--world" || arguments[1] == "-w") && !arguments[2].empty()) {
-            Game_Action = GA_ENTER_WORLD;
-            Game_Action_Data_Middle.add("enter_world", arguments[2]);
-        }
-        // enter main menu
-        else {
-            Game_Action = GA_ENTER_MENU;
-            Game_Action_Data_Middle.add("load_menu", int_to_string(MENU_MAIN));
-        }
-
-        Game_Action_Data_Start.add("screen_fadeout", int_to_string(EFFECT_OUT_BLACK));
-        Game_Action_Data_Start.add("screen_fadeout_speed", "3");
-        Game_Action_Data_End.add("screen_fadein", int_to_string(EFFECT_IN_BLACK));
-        Game_Action_Data_End.add("screen_fadein_speed", "3");
-
-        // game loop
-#ifndef _DEBUG
-        try {
-#endif
-            while (!game_exit and !game_reset) {
-                // update
-                Update_Game();
-                // draw
-                Draw_Game();
-
-                // render
-#ifdef TSC_RENDER_THREAD_TEST
-                pVideo->Render(1);
-#else
-                pVideo->Render();
-#endif
-
-                // update speedfactor
-                pFramerate->Update();
-            }
-#ifndef _DEBUG
-        }
-        catch (...) {
-            /* Cleanup and exit with non-success status. This is done
-             * only in release mode, because the try/catch statement
-             * unwinds the stack and confuses GDB. Running GDB's
-             * "backtrace" command on an exception re-thrown like this
-             * causes it to print the backtrace to the re-throw
-             * statement below, which is not useful at all. In debug
-             * mode, the original exception needs to terminate the
-             * programme so debugging the problem is easier. */
-            std::cerr << "Uncought exception. You might want to file a bug; see <https://secretchronicles.org/>." << std::endl;
-            Exit_Game();
-            throw;
-        }
-#endif
-
-        Exit_Game();
-
-        // reset should start fresh, so reset level and world
-        argc = 0;
-
-    } while (game_reset);
-    return EXIT_SUCCESS;
-}
-
-// namespace is set here to exclude main() from it
 namespace TSC {
 
 void Init_Game(void)
@@ -253,6 +65,7 @@ void Init_Game(void)
     pVideo = new cVideo();
     pAudio = new cAudio();
     pFramerate = new cFramerate();
+    pJob_System = new cJob_System();
     pRenderer = new cRenderQueue(200);
     pRenderer_current = new cRenderQueue(200);
     pImage_Manager = new cImage_Manager();
@@ -438,6 +251,16 @@ void Exit_Game(void)
         pMenuCore = NULL;
     }
 
+    if (pJob_System) {
+        delete pJob_System;
+        pJob_System = NULL;
+    }
+
+    // the render thread uses the render queues
+    if (pVideo) {
+        pVideo->m_render_thread.Stop();
+    }
+
     if (pRenderer) {
         delete pRenderer;
         pRenderer = NULL;
@@ -604,6 +427,15 @@ void Update_Game(void)
     pAudio->Resume_Music();
     pAudio->Update();
 
+    // ## level preloading
+    pLevel_Manager->m_preloader->Update();
+
+    // ## finished savegames
+    pSavegame->Update();
+
+    // ## texture budget
+    pImage_Manager->Update();
+
     // performance measuring
     pFramerate->m_perf_last_ticks = TSC_GetTicks();
 
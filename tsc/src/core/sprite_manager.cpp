@@ -21,11 +21,18 @@
 #include "../overworld/world_player.hpp"
 #include "../enemies/enemy.hpp"
 #include "../core/global_basic.hpp"
+#include "../core/job_system.hpp"
+#include <cassert>
 
 using namespace std;
 
 namespace TSC {
 
+// thread-safe sprites needed for a parallel update
+static const size_t sprite_parallel_update_min = 64;
+// sprites updated by one job
+static const size_t sprite_parallel_update_batch = 32;
+
 /* *** *** *** *** *** *** cSprite_Manager *** *** *** *** *** *** *** *** *** *** *** */
 
 cSprite_Manager::cSprite_Manager(unsigned int reserve_items /* = 2000 */, unsigned int zpos_items /* = 100 */)
@@ -36,6 +43,7 @@ cSprite_Manager::cSprite_Manager(unsigned int reserve_items /* = 2000 */, unsign
     m_max_uid_mark = 1; // UID 0 is reserved for the player
     m_z_pos_data.assign(zpos_items, 0.0f);
     m_z_pos_data_editor.assign(zpos_items,0.0f);
+    m_free_slots_dirty = 0;
 }
 
 cSprite_Manager::~cSprite_Manager(void)
@@ -50,6 +58,12 @@ void cSprite_Manager::Add(cSprite* sprite)
         return;
     }
 
+    // spawned by a parallel update
+    if (cJob_System::Is_In_Job()) {
+        cJob_System::Run_Synced(std::bind(&cSprite_Manager::Add, this, sprite));
+        return;
+    }
+
     // Ensure sprites of the same layer get slightly different Z
     // coordinates. See method docs in sprite_manager.hpp for more
     //information.
@@ -78,27 +92,150 @@ void cSprite_Manager::Add(cSprite* sprite)
         m_uid_pool.erase(sprite->m_uid);
     }
 
+    if (m_free_slots_dirty) {
+        Rebuild_Free_Slots();
+    }
+
     // Check if an destroyed object can be replaced
-    for (cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+    while (!m_free_slots.empty()) {
+        const size_t slot = m_free_slots.top();
+        m_free_slots.pop();
+
+        // outdated
+        if (slot >= objects.size() || !objects[slot]->m_auto_destroy) {
+            continue;
+        }
+
         // get object pointer
-        cSprite* obj = (*itr);
+        cSprite* obj = objects[slot];
+
+        // set new object
+        objects[slot] = sprite;
+        sprite->m_sprite_manager_slot = slot;
+
+        // Release old sprite’s UID by putting it back into the UID pool
+        m_uid_pool.insert(obj->m_uid);
+
+        // delete old
+        delete obj;
+
+        m_static_layer.Add(sprite);
+        m_activation_regions.Add(sprite);
+        return;
+    }
+
+    sprite->m_sprite_manager_slot = objects.size();
+    cObject_Manager<cSprite>::Add(sprite);
+    m_static_layer.Add(sprite);
+    m_activation_regions.Add(sprite);
+}
+
+bool cSprite_Manager::Delete(size_t array_num, bool delete_data /* = 1 */)
+{
+    if (array_num < objects.size()) {
+        objects[array_num]->m_sprite_manager_slot = -1;
+        m_activation_regions.Remove(objects[array_num]);
+    }
+
+    // following sprites move down
+    m_free_slots_dirty = 1;
+
+    return cObject_Manager<cSprite>::Delete(array_num, delete_data);
+}
+
+bool cSprite_Manager::Delete(cSprite* obj, bool delete_data /* = 1 */)
+{
+    if (obj) {
+        obj->m_sprite_manager_slot = -1;
+        m_activation_regions.Remove(obj);
+    }
+
+    // following sprites move down
+    m_free_slots_dirty = 1;
+
+    return cObject_Manager<cSprite>::Delete(obj, delete_data);
+}
+
+void cSprite_Manager::Release_Slot(cSprite* sprite)
+{
+    // collected with the next rebuild
+    if (m_free_slots_dirty) {
+        return;
+    }
+
+    const int slot = sprite->m_sprite_manager_slot;
+
+    // never added
+    if (slot < 0) {
+        return;
+    }
+
+    // not at its slot anymore
+    if (static_cast<size_t>(slot) >= objects.size() || objects[slot] != sprite) {
+        m_free_slots_dirty = 1;
+        return;
+    }
+
+    m_free_slots.push(slot);
+}
+
+void cSprite_Manager::Rebuild_Free_Slots(void)
+{
+    m_free_slots = FreeSlotQueue();
+
+    for (size_t i = 0; i < objects.size(); i++) {
+        cSprite* obj = objects[i];
+
+        obj->m_sprite_manager_slot = i;
 
-        // if destroy is set
         if (obj->m_auto_destroy) {
-            // set new object
-            *itr = sprite;
+            m_free_slots.push(i);
+        }
+    }
 
-            // Release old sprite’s UID by putting it back into the UID pool
-            m_uid_pool.insert(obj->m_uid);
+    m_free_slots_dirty = 0;
+}
 
-            // delete old
-            delete obj;
+void cSprite_Manager::Update_Thread_Safe_Items(const cSprite_List& sprites)
+{
+    m_thread_safe_sprites.clear();
 
-            return;
+    for (cSprite_List::const_iterator itr = sprites.begin(); itr != sprites.end(); ++itr) {
+        cSprite* obj = (*itr);
+
+        // removed
+        if (!obj) {
+            continue;
+        }
+
+        if (obj->m_thread_safe_update && !obj->m_static_layer) {
+            // would make the rand() sequence depend on the worker timing
+            assert(!obj->Has_Random_Frames());
+            m_thread_safe_sprites.push_back(obj);
         }
     }
 
-    cObject_Manager<cSprite>::Add(sprite);
+    // not worth waking the workers
+    if (!pJob_System || m_thread_safe_sprites.size() < sprite_parallel_update_min) {
+        for (cSprite_List::iterator itr = m_thread_safe_sprites.begin(); itr != m_thread_safe_sprites.end(); ++itr) {
+            (*itr)->Update();
+        }
+    }
+    else {
+        pJob_System->Run(m_thread_safe_sprites.size(), sprite_parallel_update_batch, [this](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                m_thread_safe_sprites[i]->Update();
+            }
+        });
+    }
+
+    m_thread_safe_sprites.clear();
+}
+
+bool cSprite_Manager::Is_Static_Layer_Active(void) const
+{
+    // the editor draws the start values and debug mode draws the collision rects of each sprite
+    return !editor_enabled && !game_debug;
 }
 
 cSprite* cSprite_Manager::Copy(unsigned int identifier)
@@ -182,6 +319,9 @@ void cSprite_Manager::Move_To_Front(cSprite* sprite)
     objects.erase(itr);
     objects.front() = sprite;
     objects.insert(objects.begin() + 1, first);
+    m_free_slots_dirty = 1;
+    m_activation_regions.Set_Dirty();
+    m_static_layer.Set_Dirty();
 
     // make it the first z position
     sprite->m_pos_z = Get_First(sprite->m_type)->m_pos_z - cSprite::m_pos_z_delta;
@@ -213,6 +353,9 @@ void cSprite_Manager::Move_To_Back(cSprite* sprite)
     objects.erase(itr);
     objects.back() = sprite;
     objects.insert(objects.end() - 1, last);
+    m_free_slots_dirty = 1;
+    m_activation_regions.Set_Dirty();
+    m_static_layer.Set_Dirty();
 
     // make it the last z position
     Ensure_Different_Z(sprite);
@@ -231,6 +374,9 @@ void cSprite_Manager::Delete_All(bool delayed /* = 0 */)
     }
     // instant
     else {
+        m_static_layer.Clear();
+        m_activation_regions.Clear(objects);
+
         // remove objects that can not be auto-deleted
         for (cSprite_List::iterator itr = objects.begin(); itr != objects.end();) {
             // get object pointer
@@ -246,6 +392,9 @@ void cSprite_Manager::Delete_All(bool delayed /* = 0 */)
         }
 
         cObject_Manager<cSprite>::Delete_All();
+
+        m_free_slots = FreeSlotQueue();
+        m_free_slots_dirty = 0;
     }
 
     // Empty the UID pool, we have no sprites anymore
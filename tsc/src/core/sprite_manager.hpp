@@ -20,6 +20,10 @@
 #include "../core/global_game.hpp"
 #include "../core/obj_manager.hpp"
 #include "../objects/movingsprite.hpp"
+#include "../core/static_sprite_layer.hpp"
+#include "../core/activation_regions.hpp"
+#include <queue>
+#include <functional>
 
 namespace TSC {
 
@@ -35,6 +39,15 @@ namespace TSC {
          * it will not be touched, otherwise it is assigned a free UID.
          */
         virtual void Add(cSprite* sprite);
+        // Delete the sprite from given array number
+        virtual bool Delete(size_t array_num, bool delete_data = 1);
+        // Delete the given sprite
+        virtual bool Delete(cSprite* obj, bool delete_data = 1);
+        /* Remember the slot of the destroyed sprite
+         * it is reused by the next Add()
+         * called from cSprite::Destroy()
+        */
+        void Release_Slot(cSprite* sprite);
 
         // Return a sprite copy
         cSprite* Copy(unsigned int identifier);
@@ -81,23 +94,89 @@ namespace TSC {
         void Get_Colliding_Objects(cSprite_List& col_objects, const GL_rect& rect, bool with_player = 0, const cSprite* exclude_sprite = NULL) const;
         void Get_Colliding_Objects(cSprite_List& col_objects, const GL_Circle& circle, bool with_player = 0, const cSprite* exclude_sprite = NULL) const;
 
+        // if the static sprites are drawn by the static layer
+        bool Is_Static_Layer_Active(void) const;
         // Update items drawing validation
         inline void Update_Items_Valid_Draw(void)
         {
+            const bool static_layer = Is_Static_Layer_Active();
+
+            if (m_activation_regions.Is_Active()) {
+                cSprite_List& active_sprites = m_activation_regions.Lock(objects);
+
+                for (size_t i = 0; i < active_sprites.size(); i++) {
+                    cSprite* obj = active_sprites[i];
+
+                    if (!obj || (static_layer && obj->m_static_layer)) {
+                        continue;
+                    }
+
+                    obj->Update_Valid_Draw();
+                }
+
+                m_activation_regions.Unlock();
+                return;
+            }
+
             for (cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+                if (static_layer && (*itr)->m_static_layer) {
+                    continue;
+                }
+
                 (*itr)->Update_Valid_Draw();
             }
         }
         // Update items
         inline void Update_Items(void)
         {
+            if (m_activation_regions.Is_Active()) {
+                cSprite_List& active_sprites = m_activation_regions.Lock(objects);
+
+                Update_Thread_Safe_Items(active_sprites);
+
+                // sprites added while updating are appended and updated as well
+                for (size_t i = 0; i < active_sprites.size(); i++) {
+                    cSprite* obj = active_sprites[i];
+
+                    // removed or static sprites have nothing to update
+                    if (!obj || obj->m_static_layer || obj->m_thread_safe_update) {
+                        continue;
+                    }
+
+                    obj->Update();
+                }
+
+                m_activation_regions.Unlock();
+                return;
+            }
+
+            Update_Thread_Safe_Items(objects);
+
             for (cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+                // static sprites have nothing to update
+                if ((*itr)->m_static_layer || (*itr)->m_thread_safe_update) {
+                    continue;
+                }
+
                 (*itr)->Update();
             }
         }
         // Update_Late items
         inline void Update_Items_Late(void)
         {
+            if (m_activation_regions.Is_Active()) {
+                cSprite_List& active_sprites = m_activation_regions.Lock(objects);
+
+                for (size_t i = 0; i < active_sprites.size(); i++) {
+                    if (active_sprites[i]) {
+                        active_sprites[i]->Update_Late();
+                    }
+                }
+
+                m_activation_regions.Unlock();
+                return;
+            }
+
             for (cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
                 (*itr)->Update_Late();
             }
@@ -105,9 +184,45 @@ namespace TSC {
         // Draw items
         inline void Draw_Items(void)
         {
+            if (m_activation_regions.Is_Active()) {
+                const bool static_layer = Is_Static_Layer_Active();
+                cSprite_List& active_sprites = m_activation_regions.Lock(objects);
+
+                for (size_t i = 0; i < active_sprites.size(); i++) {
+                    cSprite* obj = active_sprites[i];
+
+                    if (!obj || (static_layer && obj->m_static_layer)) {
+                        continue;
+                    }
+
+                    obj->Draw();
+                }
+
+                if (static_layer) {
+                    m_static_layer.Draw(active_sprites);
+                }
+
+                m_activation_regions.Unlock();
+                return;
+            }
+
+            if (!Is_Static_Layer_Active()) {
+                for (cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+                    (*itr)->Draw();
+                }
+
+                return;
+            }
+
             for (cSprite_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+                if ((*itr)->m_static_layer) {
+                    continue;
+                }
+
                 (*itr)->Draw();
             }
+
+            m_static_layer.Draw(objects);
         }
 
         // Create Collision data and Handle the collisions
@@ -136,6 +251,11 @@ namespace TSC {
         // if `new_max_uid_mark' is smaller than the current max mark.
         void Allocate_UIDs(long new_max_uid_mark);
 
+        // plain level geometry
+        cStatic_Sprite_Layer m_static_layer;
+        // sleeping of the sprites far away from the camera
+        cActivation_Regions m_activation_regions;
+
         typedef vector<float> ZposList;
         // biggest type z position
         ZposList m_z_pos_data;
@@ -193,6 +313,22 @@ namespace TSC {
          * are ensured to be placed in front of older ones.
          */
         void Ensure_Different_Z(cSprite* sprite);
+
+        // Renumber the sprite slots and collect the destroyed sprites
+        void Rebuild_Free_Slots(void);
+
+        /* Update the given sprites with a thread-safe update
+         * in parallel with the job system if there are enough
+        */
+        void Update_Thread_Safe_Items(const cSprite_List& sprites);
+        // sprites of the current parallel update
+        cSprite_List m_thread_safe_sprites;
+
+        typedef std::priority_queue<size_t, std::vector<size_t>, std::greater<size_t> > FreeSlotQueue;
+        // slots of destroyed sprites with the lowest first
+        FreeSlotQueue m_free_slots;
+        // the objects array was reordered and the sprite slots are outdated
+        bool m_free_slots_dirty;
     };
 
     /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
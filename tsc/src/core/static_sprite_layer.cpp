@@ -0,0 +1,360 @@
+/***************************************************************************
+ * static_sprite_layer.cpp  -  batched drawing of the static level geometry
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../core/static_sprite_layer.hpp"
+#include "../core/game_core.hpp"
+#include "../core/camera.hpp"
+#include "../video/gl_surface.hpp"
+#include "../video/renderer.hpp"
+#include <typeinfo>
+
+using namespace std;
+
+namespace TSC {
+
+/* *** *** *** *** *** *** cStatic_Sprite_Layer *** *** *** *** *** *** *** *** *** *** *** */
+
+const float cStatic_Sprite_Layer::m_chunk_size = 512.0f;
+
+// sort by z position
+struct static_sprite_z_sort {
+    bool operator()(const cSprite* a, const cSprite* b) const
+    {
+        return a->m_pos_z < b->m_pos_z;
+    }
+};
+
+/* Set the quad of the sprite
+ * same as cSprite::Draw_Image_Normal
+*/
+static void Set_Batch_Item(const cSprite* sprite, cSurface_Batch_Item& item)
+{
+    const cGL_Surface* image = sprite->m_image;
+
+    item.m_scale_x = 1.0f;
+    item.m_scale_y = 1.0f;
+    item.m_pos_x = sprite->m_pos_x + image->m_int_x;
+    item.m_pos_y = sprite->m_pos_y + image->m_int_y;
+
+    // scale x
+    if (sprite->m_scale_x != 1.0f) {
+        // scale to the right and left
+        if (sprite->m_scale_right && sprite->m_scale_left) {
+            item.m_scale_x = sprite->m_scale_x;
+            item.m_pos_x = sprite->m_pos_x + (image->m_int_x * sprite->m_scale_x) - ((image->m_w * 0.5f) * (sprite->m_scale_x - 1.0f));
+        }
+        // scale to the right only
+        else if (sprite->m_scale_right) {
+            item.m_scale_x = sprite->m_scale_x;
+            item.m_pos_x = sprite->m_pos_x + (image->m_int_x * sprite->m_scale_x);
+        }
+        // scale to the left only
+        else if (sprite->m_scale_left) {
+            item.m_scale_x = sprite->m_scale_x;
+            item.m_pos_x = sprite->m_pos_x + (image->m_int_x * sprite->m_scale_x) - ((image->m_w) * (sprite->m_scale_x - 1.0f));
+        }
+    }
+    // scale y
+    if (sprite->m_scale_y != 1.0f) {
+        // scale down and up
+        if (sprite->m_scale_down && sprite->m_scale_up) {
+            item.m_scale_y = sprite->m_scale_y;
+            item.m_pos_y = sprite->m_pos_y + (image->m_int_y * sprite->m_scale_y) - ((image->m_h * 0.5f) * (sprite->m_scale_y - 1.0f));
+        }
+        // scale down only
+        else if (sprite->m_scale_down) {
+            item.m_scale_y = sprite->m_scale_y;
+            item.m_pos_y = sprite->m_pos_y + (image->m_int_y * sprite->m_scale_y);
+        }
+        // scale up only
+        else if (sprite->m_scale_up) {
+            item.m_scale_y = sprite->m_scale_y;
+            item.m_pos_y = sprite->m_pos_y + (image->m_int_y * sprite->m_scale_y) - ((image->m_h) * (sprite->m_scale_y - 1.0f));
+        }
+    }
+
+    item.m_pos_z = sprite->m_pos_z;
+    item.m_rot_x = sprite->m_rot_x + image->m_base_rot_x;
+    item.m_rot_y = sprite->m_rot_y + image->m_base_rot_y;
+    item.m_rot_z = sprite->m_rot_z + image->m_base_rot_z;
+    item.m_color = sprite->m_color;
+}
+
+cStatic_Sprite_Layer::cStatic_Sprite_Layer(void)
+{
+    m_dirty = 0;
+}
+
+cStatic_Sprite_Layer::~cStatic_Sprite_Layer(void)
+{
+    Clear();
+}
+
+bool cStatic_Sprite_Layer::Is_Static_Sprite(const cSprite* sprite)
+{
+    // only plain sprites
+    if (typeid(*sprite) != typeid(cSprite)) {
+        return 0;
+    }
+
+    if (sprite->m_type != TYPE_PASSIVE && sprite->m_type != TYPE_FRONT_PASSIVE && sprite->m_type != TYPE_MASSIVE && sprite->m_type != TYPE_HALFMASSIVE && sprite->m_type != TYPE_CLIMBABLE) {
+        return 0;
+    }
+
+    // needs to be drawn on its own
+    if (!sprite->m_image || sprite->m_anim_enabled || sprite->m_combine_type || sprite->m_shadow_pos || sprite->m_no_camera || sprite->m_auto_destroy) {
+        return 0;
+    }
+
+    return 1;
+}
+
+void cStatic_Sprite_Layer::Add(cSprite* sprite)
+{
+    if (sprite->m_static_layer || !Is_Static_Sprite(sprite)) {
+        return;
+    }
+
+    sprite->m_static_layer = this;
+    m_sprites.push_back(sprite);
+    m_dirty = 1;
+}
+
+void cStatic_Sprite_Layer::Remove(cSprite* sprite)
+{
+    if (sprite->m_static_layer != this) {
+        return;
+    }
+
+    cSprite_List::iterator itr = std::find(m_sprites.begin(), m_sprites.end(), sprite);
+
+    if (itr != m_sprites.end()) {
+        *itr = m_sprites.back();
+        m_sprites.pop_back();
+    }
+
+    sprite->m_static_layer = NULL;
+    m_dirty = 1;
+}
+
+void cStatic_Sprite_Layer::Clear(void)
+{
+    for (cSprite_List::iterator itr = m_sprites.begin(); itr != m_sprites.end(); ++itr) {
+        (*itr)->m_static_layer = NULL;
+    }
+
+    m_sprites.clear();
+    m_chunks.clear();
+    m_split_z.clear();
+    m_batch_z_ranges.clear();
+    m_dirty = 0;
+}
+
+void cStatic_Sprite_Layer::Build(const cSprite_List& other_sprites)
+{
+    m_chunks.clear();
+    m_split_z.clear();
+    m_batch_z_ranges.clear();
+
+    // no other sprite may be drawn inside a batch
+    for (cSprite_List::const_iterator itr = other_sprites.begin(); itr != other_sprites.end(); ++itr) {
+        if (*itr && !(*itr)->m_static_layer) {
+            m_split_z.push_back((*itr)->m_pos_z);
+        }
+    }
+
+    if (pActive_Player) {
+        m_split_z.push_back(pActive_Player->m_pos_z);
+    }
+
+    std::sort(m_split_z.begin(), m_split_z.end());
+
+    // sprites of each chunk
+    std::map<std::pair<int, int>, cSprite_List> chunk_sprites;
+
+    for (cSprite_List::iterator itr = m_sprites.begin(); itr != m_sprites.end();) {
+        cSprite* sprite = (*itr);
+
+        // changed and is now drawn by the sprite manager
+        if (!Is_Static_Sprite(sprite)) {
+            sprite->m_static_layer = NULL;
+            *itr = m_sprites.back();
+            m_sprites.pop_back();
+            continue;
+        }
+
+        ++itr;
+
+        if (!sprite->m_active) {
+            continue;
+        }
+
+        chunk_sprites[std::make_pair(static_cast<int>(floor(sprite->m_pos_x / m_chunk_size)), static_cast<int>(floor(sprite->m_pos_y / m_chunk_size)))].push_back(sprite);
+    }
+
+    for (std::map<std::pair<int, int>, cSprite_List>::iterator chunk_itr = chunk_sprites.begin(); chunk_itr != chunk_sprites.end(); ++chunk_itr) {
+        cSprite_List& sprites = chunk_itr->second;
+        cChunk& chunk = m_chunks[chunk_itr->first];
+
+        // batches must keep the drawing order of the sprites
+        std::sort(sprites.begin(), sprites.end(), static_sprite_z_sort());
+
+        Batch_Items* items = NULL;
+        const cSprite* last_sprite = NULL;
+
+        for (cSprite_List::const_iterator itr = sprites.begin(); itr != sprites.end(); ++itr) {
+            const cSprite* sprite = (*itr);
+
+            // start a new batch if the image or massive type changed or another sprite is drawn in between
+            if (!items || sprite->m_image != last_sprite->m_image || sprite->m_massive_type != last_sprite->m_massive_type) {
+                items = NULL;
+            }
+            else {
+                std::vector<float>::const_iterator split = std::upper_bound(m_split_z.begin(), m_split_z.end(), last_sprite->m_pos_z);
+
+                if (split != m_split_z.end() && *split <= sprite->m_pos_z) {
+                    items = NULL;
+                }
+            }
+
+            if (!items) {
+                items = new Batch_Items();
+
+                chunk.m_batches.push_back(cBatch());
+                chunk.m_batches.back().m_image = sprite->m_image;
+                chunk.m_batches.back().m_pos_z = sprite->m_pos_z;
+                chunk.m_batches.back().m_items.reset(items);
+            }
+
+            chunk.m_batches.back().m_last_pos_z = sprite->m_pos_z;
+
+            items->push_back(cSurface_Batch_Item());
+            cSurface_Batch_Item& item = items->back();
+            Set_Batch_Item(sprite, item);
+            last_sprite = sprite;
+
+            // drawn area with space for rotation
+            const float size = max(sprite->m_image->m_w * item.m_scale_x, sprite->m_image->m_h * item.m_scale_y);
+            GL_rect rect(item.m_pos_x, item.m_pos_y, size, size);
+
+            if (itr == sprites.begin()) {
+                chunk.m_rect = rect;
+            }
+            else {
+                const float right = max(chunk.m_rect.m_x + chunk.m_rect.m_w, rect.m_x + rect.m_w);
+                const float bottom = max(chunk.m_rect.m_y + chunk.m_rect.m_h, rect.m_y + rect.m_h);
+
+                chunk.m_rect.m_x = min(chunk.m_rect.m_x, rect.m_x);
+                chunk.m_rect.m_y = min(chunk.m_rect.m_y, rect.m_y);
+                chunk.m_rect.m_w = right - chunk.m_rect.m_x;
+                chunk.m_rect.m_h = bottom - chunk.m_rect.m_y;
+            }
+        }
+    }
+
+    for (ChunkMap::const_iterator chunk_itr = m_chunks.begin(); chunk_itr != m_chunks.end(); ++chunk_itr) {
+        for (BatchList::const_iterator itr = chunk_itr->second.m_batches.begin(); itr != chunk_itr->second.m_batches.end(); ++itr) {
+            if (itr->m_last_pos_z > itr->m_pos_z) {
+                m_batch_z_ranges.push_back(std::make_pair(itr->m_pos_z, itr->m_last_pos_z));
+            }
+        }
+    }
+
+    // merge the overlapping ranges
+    std::sort(m_batch_z_ranges.begin(), m_batch_z_ranges.end());
+    size_t merged = 0;
+
+    for (size_t i = 1; i < m_batch_z_ranges.size(); i++) {
+        if (m_batch_z_ranges[i].first <= m_batch_z_ranges[merged].second) {
+            m_batch_z_ranges[merged].second = max(m_batch_z_ranges[merged].second, m_batch_z_ranges[i].second);
+        }
+        else {
+            m_batch_z_ranges[++merged] = m_batch_z_ranges[i];
+        }
+    }
+
+    if (!m_batch_z_ranges.empty()) {
+        m_batch_z_ranges.resize(merged + 1);
+    }
+
+    m_dirty = 0;
+}
+
+bool cStatic_Sprite_Layer::Is_Inside_Batch(float pos_z) const
+{
+    // last range starting before the z position
+    std::vector<std::pair<float, float> >::const_iterator itr = std::lower_bound(m_batch_z_ranges.begin(), m_batch_z_ranges.end(), pos_z, [](const std::pair<float, float>& range, float z) {
+        return range.first < z;
+    });
+
+    if (itr == m_batch_z_ranges.begin()) {
+        return 0;
+    }
+
+    --itr;
+    return pos_z <= itr->second;
+}
+
+void cStatic_Sprite_Layer::Draw(const cSprite_List& other_sprites)
+{
+    // a sprite got a z position inside a batch
+    if (!m_dirty) {
+        for (cSprite_List::const_iterator itr = other_sprites.begin(); itr != other_sprites.end(); ++itr) {
+            if (*itr && !(*itr)->m_static_layer && Is_Inside_Batch((*itr)->m_pos_z)) {
+                m_dirty = 1;
+                break;
+            }
+        }
+
+        if (pActive_Player && Is_Inside_Batch(pActive_Player->m_pos_z)) {
+            m_dirty = 1;
+        }
+    }
+
+    if (m_dirty) {
+        Build(other_sprites);
+    }
+
+    const GL_rect camera_rect = pActive_Camera->Get_Rect();
+
+    for (ChunkMap::const_iterator chunk_itr = m_chunks.begin(); chunk_itr != m_chunks.end(); ++chunk_itr) {
+        const cChunk& chunk = chunk_itr->second;
+
+        // not visible
+        if (!camera_rect.Intersects(chunk.m_rect)) {
+            continue;
+        }
+
+        for (BatchList::const_iterator itr = chunk.m_batches.begin(); itr != chunk.m_batches.end(); ++itr) {
+            const cBatch& batch = (*itr);
+
+            cSurface_Batch_Request* request = new cSurface_Batch_Request();
+            request->m_texture_id = batch.m_image->Get_Texture();
+            request->m_w = batch.m_image->m_start_w;
+            request->m_h = batch.m_image->m_start_h;
+            request->m_content_w = batch.m_image->m_content_w;
+            request->m_content_h = batch.m_image->m_content_h;
+            request->m_pos_z = batch.m_pos_z;
+            request->m_no_camera = 0;
+            request->m_shared_items = batch.m_items;
+
+            pRenderer->Add(request);
+        }
+    }
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
@@ -0,0 +1,115 @@
+/***************************************************************************
+ * static_sprite_layer.hpp
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_STATIC_SPRITE_LAYER_HPP
+#define TSC_STATIC_SPRITE_LAYER_HPP
+
+#include "../core/global_basic.hpp"
+#include "../core/math/rect.hpp"
+#include "../objects/sprite.hpp"
+#include "../video/renderer.hpp"
+
+namespace TSC {
+
+    /* *** *** *** *** *** cStatic_Sprite_Layer *** *** *** *** *** *** *** *** *** *** *** *** */
+
+    /* Batched drawing of the plain level geometry of a sprite manager
+     * Passive, massive, halfmassive and climbable sprites without animation or
+     * special effects are sorted into chunks of the level. Only the chunks
+     * visible with the active camera are drawn. Sprites of a chunk following
+     * each other in z order with the same image and massive type are sent as
+     * one batch request at the z position of the first one. A batch is split
+     * at the z position of every other drawn sprite, so none is drawn inside
+     * it in the wrong order. The quads of the batches are only built again if
+     * a sprite of the layer changed or another sprite got a z position inside
+     * a batch.
+     * Only the drawing is batched. The sprites stay full cSprite objects in
+     * the sprite manager for collision, saving, scripting and the editor.
+     * While the editor is enabled they are drawn as usual.
+    */
+    class cStatic_Sprite_Layer {
+    public:
+        cStatic_Sprite_Layer(void);
+        ~cStatic_Sprite_Layer(void);
+
+        // returns true if the given sprite can be drawn by this layer
+        static bool Is_Static_Sprite(const cSprite* sprite);
+
+        // Add the sprite if it is static
+        void Add(cSprite* sprite);
+        // Remove the sprite
+        void Remove(cSprite* sprite);
+        // Remove all sprites
+        void Clear(void);
+
+        // rebuild the chunks before the next draw
+        inline void Set_Dirty(void)
+        {
+            m_dirty = 1;
+        };
+
+        /* Draw the visible chunks
+         * other_sprites : the sprites drawn with the layer, may contain NULL
+        */
+        void Draw(const cSprite_List& other_sprites);
+
+        // chunk size in level pixels
+        static const float m_chunk_size;
+    private:
+        typedef std::vector<cSurface_Batch_Item> Batch_Items;
+
+        class cBatch {
+        public:
+            // image of all sprites
+            cGL_Surface* m_image;
+            // z position of the first sprite
+            float m_pos_z;
+            // z position of the last sprite
+            float m_last_pos_z;
+            // quads shared with the render requests
+            std::shared_ptr<const Batch_Items> m_items;
+        };
+        typedef std::vector<cBatch> BatchList;
+
+        class cChunk {
+        public:
+            // area covered by the sprites of this chunk
+            GL_rect m_rect;
+            // sorted by z position
+            BatchList m_batches;
+        };
+        typedef std::map<std::pair<int, int>, cChunk> ChunkMap;
+
+        /* sort the sprites into chunks and build their batches
+         * other_sprites : the sprites drawn with the layer
+        */
+        void Build(const cSprite_List& other_sprites);
+        // returns true if the z position is after the first and up to the last sprite of a batch
+        bool Is_Inside_Batch(float pos_z) const;
+
+        cSprite_List m_sprites;
+        ChunkMap m_chunks;
+        // z positions of the other sprites the batches were split at, sorted
+        std::vector<float> m_split_z;
+        // merged z ranges covered by the batches after their first sprite, sorted
+        std::vector<std::pair<float, float> > m_batch_z_ranges;
+        bool m_dirty;
+    };
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
@@ -772,10 +772,10 @@ void cTurtleBoss::Handle_Collision_Player(cObjectCollision* collision)
             gp_hud->Add_Points(250, pLevel_Player->m_pos_x, pLevel_Player->m_pos_y);
 
             if (m_hits + 1 == m_max_hits) {
-                pAudio->Play_Sound("enemy/boss/turtle/big_hit.ogg");
+                pAudio->Play_Sound("enemy/boss/turtle/big_hit.ogg", -1, -1, false, SOUND_PRIORITY_HIGH);
             }
             else {
-                pAudio->Play_Sound("enemy/boss/turtle/hit.ogg");
+                pAudio->Play_Sound("enemy/boss/turtle/hit.ogg", -1, -1, false, SOUND_PRIORITY_HIGH);
             }
         }
         else if (m_turtle_state == TURTLEBOSS_SHELL_STAND) {
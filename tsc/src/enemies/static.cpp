@@ -58,7 +58,7 @@ cStaticEnemy::cStaticEnemy(XmlAttributes& attributes, cSprite_Manager* sprite_ma
     Set_Rotation_Speed(string_to_float(attributes.fetch("rotation_speed", "-7.5")));
 
     // image
-    m_image_filename = attributes.fetch("image", m_image_filename); // Init sets m_image_filename default
+    m_image_filename = attributes.fetch("image", m_image_filename.str()); // Init sets m_image_filename default
     Clear_Images();
     Add_Image_Set("main", utf8_to_path(m_image_filename));
     Set_Image_Set("main", true);
@@ -129,7 +129,7 @@ xmlpp::Element* cStaticEnemy::Save_To_XML_Node(xmlpp::Element* p_element)
 {
     xmlpp::Element* p_node = cEnemy::Save_To_XML_Node(p_element);
 
-    Replace_Property(p_node, "image", m_image_filename);
+    Replace_Property(p_node, "image", m_image_filename.str());
     Add_Property(p_node, "rotation_speed", m_rotation_speed);
     Add_Property(p_node, "path", m_path_state.m_path_identifier);
     Add_Property(p_node, "speed", m_speed);
@@ -19,6 +19,8 @@
 #include "../core/framerate.hpp"
 #include "../core/camera.hpp"
 #include "../core/property_helper.hpp"
+#include "../core/interned_string.hpp"
+#include "../video/img_manager.hpp"
 #include "../level/level.hpp"
 #include "../level/level_player.hpp"
 #include "../overworld/overworld.hpp"
@@ -31,6 +33,16 @@ TSC::cDebug_Window* TSC::gp_debug_window = NULL;
 
 using namespace TSC;
 
+// estimated memory of all sprites of one type
+struct Sprite_Type_Memory {
+    Sprite_Type_Memory(void)
+        : m_bytes(0), m_count(0) {}
+
+    std::string m_name;
+    size_t m_bytes;
+    unsigned int m_count;
+};
+
 cDebug_Window::cDebug_Window(cSprite_Manager* p_sprite_manager)
     : mp_sprite_manager(p_sprite_manager),
       mp_debugwin_root(NULL)
@@ -143,7 +155,13 @@ void cDebug_Window::Update()
     int bonusboxes = 0;
     int goldboxes = 0;
     int moving_platforms = 0;
+    // estimated memory by sprite type
+    std::map<SpriteType, Sprite_Type_Memory> memory;
     for (cSprite* p_obj: mp_sprite_manager->objects) {
+        Sprite_Type_Memory& type_memory = memory[p_obj->m_type];
+        type_memory.m_name = p_obj->m_type_name.c_str();
+        type_memory.m_bytes += p_obj->Get_Memory_Size();
+        type_memory.m_count++;
         if (p_obj->m_massive_type == MASS_HALFMASSIVE) {
             halfmassives++;
         }
@@ -180,6 +198,65 @@ void cDebug_Window::Update()
              moving_platforms);
     mp_debugwin_root->getChild("objectcount2")->setText(reinterpret_cast<const CEGUI::utf8*>(buf));
 
+    // the types using the most memory in total come first
+    std::vector<Sprite_Type_Memory> type_memories;
+    for (const std::pair<const SpriteType, Sprite_Type_Memory>& entry: memory) {
+        type_memories.push_back(entry.second);
+    }
+    std::sort(type_memories.begin(), type_memories.end(), [](const Sprite_Type_Memory& a, const Sprite_Type_Memory& b) {
+        return a.m_bytes > b.m_bytes;
+    });
+
+    std::string type_text;
+    for (size_t i = 0; i < type_memories.size() && i < 4; i++) {
+        type_text += type_memories[i].m_name + ": " + uint_to_string(static_cast<unsigned int>(type_memories[i].m_bytes / type_memories[i].m_count)) + " ";
+    }
+
+    size_t pool_memory = 0;
+    size_t pool_size = cInterned_String::Get_Pool_Size(&pool_memory);
+    snprintf(buf,
+             4096,
+             _("Bytes/Sprite %sStrings: %lu (%lu KiB)"),
+             type_text.c_str(),
+             static_cast<unsigned long>(pool_size),
+             static_cast<unsigned long>(pool_memory / 1024));
+    mp_debugwin_root->getChild("memory")->setText(reinterpret_cast<const CEGUI::utf8*>(buf));
+
+    size_t padded_texture_memory = 0;
+    size_t texture_memory = pImage_Manager->Get_Texture_Memory(&padded_texture_memory);
+    snprintf(buf,
+             4096,
+             _("Textures: %lu KiB Budget: %lu KiB Evicted: %u Saved by NPOT: %lu KiB"),
+             static_cast<unsigned long>(texture_memory / 1024),
+             static_cast<unsigned long>(pImage_Manager->Get_Texture_Budget() / 1024),
+             pImage_Manager->m_evicted_textures,
+             static_cast<unsigned long>((padded_texture_memory - texture_memory) / 1024));
+    mp_debugwin_root->getChild("textures")->setText(reinterpret_cast<const CEGUI::utf8*>(buf));
+
+    snprintf(buf,
+             4096,
+             _("Script GC: Live: %u Pages: %u Steps: %u Time: %u us"),
+             pFramerate->m_perf_script_gc_live,
+             pFramerate->m_perf_script_gc_pages,
+             pFramerate->m_perf_script_gc_steps,
+             pFramerate->m_perf_script_gc_time);
+    mp_debugwin_root->getChild("script_gc")->setText(reinterpret_cast<const CEGUI::utf8*>(buf));
+
+    snprintf(buf,
+             4096,
+             _("Render: %s Main: %u us Thread: %u us Wait: %u us"),
+             pVideo->m_render_thread.Is_Running() ? _("threaded") : _("single"),
+             pFramerate->m_perf_render_main_time,
+             pFramerate->m_perf_render_thread_time,
+             pFramerate->m_perf_render_wait_time);
+    mp_debugwin_root->getChild("render")->setText(reinterpret_cast<const CEGUI::utf8*>(buf));
+
+    snprintf(buf,
+             4096,
+             _("Collision allocations: %u"),
+             pFramerate->m_perf_collision_allocations);
+    mp_debugwin_root->getChild("collision")->setText(reinterpret_cast<const CEGUI::utf8*>(buf));
+
     snprintf(buf,
              4096,
              _("Player X1: %.4f X2: %.4f"),
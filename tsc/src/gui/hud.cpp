@@ -16,6 +16,7 @@
 #include "../core/framerate.hpp"
 #include "../core/filesystem/resource_manager.hpp"
 #include "../core/sprite_manager.hpp"
+#include "../user/savegame/savegame.hpp"
 #include "hud.hpp"
 
 // 35 is the number of pixels set in berry's .settings file.
@@ -175,7 +176,8 @@ void cHud::Update()
     }
 
     // Update text counter if a message is displayed
-    if (mp_message_text->isVisible()) {
+    // keep it while a savegame is written as it tells the player to wait
+    if (mp_message_text->isVisible() && !pSavegame->Is_Saving()) {
         m_text_counter -= pFramerate->m_speed_factor;
         if (m_text_counter <= 0) {
             mp_message_text->hide();
@@ -2663,9 +2663,7 @@ bool cMenu_Options::Video_Button_Apply_Clicked(const CEGUI::EventArgs& event)
     // Hide options menu
     p_options_root->hide();
 
-    CEGUI::System::getSingleton().renderAllGUIContexts();
-    pRenderer->Render();
-    pVideo->mp_window->display();
+    pVideo->Render();
 
     // apply new settings
     pPreferences->Apply_Video(m_vid_w, m_vid_h, m_vid_bpp, m_vid_fullscreen, m_vid_vsync, m_vid_geometry_detail, m_vid_texture_detail);
@@ -2693,7 +2691,7 @@ bool cMenu_Options::Video_Button_Recreate_Cache_Clicked(const CEGUI::EventArgs&
     Loading_Screen_Init();
 
     // save textures for reloading from file
-    pImage_Manager->Grab_Textures(1, 1);
+    pImage_Manager->Grab_Textures(1);
 
     // recreate cache
     pVideo->Init_Image_Cache(1);
@@ -3418,7 +3416,7 @@ void cMenu_Credits::Init_GUI(void)
 void cMenu_Credits::Enter(const GameMode old_mode /* = MODE_NOTHING */)
 {
     // black background because of fade alpha
-    glClearColor(0, 0, 0, 1);
+    pVideo->Set_Clear_Color(0, 0, 0, 1);
 
     if (old_mode == MODE_MENU) {
         // fade in
@@ -3433,7 +3431,7 @@ void cMenu_Credits::Leave(const GameMode next_mode /* = MODE_NOTHING */)
         Menu_Fade(0);
 
         // white background
-        glClearColor(1, 1, 1, 1);
+        pVideo->Set_Clear_Color(1, 1, 1, 1);
     }
 
     // set menu gradient colors back
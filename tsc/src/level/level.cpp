@@ -108,6 +108,8 @@ cLevel::cLevel(void)
     m_mruby_has_been_initialized = false;
 
     m_sprite_manager = new cSprite_Manager();
+    // only the sprites near the camera are updated
+    m_sprite_manager->m_activation_regions.Set_Enabled(1);
     m_background_manager = new cBackground_Manager();
     m_animation_manager = new cAnimation_Manager();
 
@@ -200,7 +202,7 @@ bool cLevel::New(std::string levelname)
     return 0;
 }
 
-cLevel* cLevel::Load_From_File(fs::path filename)
+cLevel* cLevel::Load_From_File(fs::path filename, const std::string* p_data /* = NULL */)
 {
     if (filename.empty())
         throw(InvalidLevelError("Empty level filename!"));
@@ -214,7 +216,12 @@ cLevel* cLevel::Load_From_File(fs::path filename)
 
     // supported level format
     if (filename.extension() == fs::path(".tsclvl")  || filename.extension() == fs::path(".smclvl")) {
-        loader.parse_file(filename);
+        if (p_data) {
+            loader.parse_memory(filename, *p_data);
+        }
+        else {
+            loader.parse_file(filename);
+        }
     }
     else { // old, unsupported level format
         gp_hud->Set_Text(_("Unsupported Level format : ") + (const std::string)path_to_utf8(filename));
@@ -636,6 +643,12 @@ void cLevel::Update(void)
             }
         }
     }
+
+    // Script garbage collection after all scripts of this frame did run
+    if (m_mruby) {
+        m_mruby->Get_Profiler().End_Frame();
+        m_mruby->Update_GC();
+    }
 }
 
 void cLevel::Update_Late(void)
@@ -33,8 +33,9 @@ namespace TSC {
     class cLevel {
     public:
 
-        /// Loads a level from the given file.
-        static cLevel* Load_From_File(boost::filesystem::path filename);
+        /// Loads a level from the given file. If `p_data' is given it is
+        /// parsed instead of reading the file again.
+        static cLevel* Load_From_File(boost::filesystem::path filename, const std::string* p_data = NULL);
 
         cLevel(void);
         virtual ~cLevel(void);
@@ -61,10 +61,9 @@ using namespace TSC;
 using namespace std;
 
 cLevelLoader::cLevelLoader()
-    : xmlpp::SaxParser()
+    : cLevel_XML_Parser()
 {
     mp_level    = NULL;
-    m_in_script_tag = false;
 }
 
 cLevelLoader::~cLevelLoader()
@@ -89,60 +88,33 @@ void cLevelLoader::parse_file(boost::filesystem::path filename)
     xmlpp::SaxParser::parse_file(path_to_utf8(filename));
 }
 
+void cLevelLoader::parse_memory(boost::filesystem::path filename, const std::string& contents)
+{
+    m_levelfile = filename;
+    xmlpp::SaxParser::parse_memory(contents);
+}
+
 void cLevelLoader::on_start_document()
 {
     if (mp_level)
         throw("Restarted XML parser after already starting it."); // FIXME: proper exception
 
     mp_level = new cLevel();
-    m_in_script_tag = false;
+    cLevel_XML_Parser::on_start_document();
 }
 
 void cLevelLoader::on_end_document()
 {
     mp_level->m_level_filename = m_levelfile;
+    mp_level->m_script.swap(m_script);
 
     // engine version entry not set
     if (mp_level->m_engine_version < 0)
         mp_level->m_engine_version = 0;
 }
 
-void cLevelLoader::on_start_element(const Glib::ustring& name, const xmlpp::SaxParser::AttributeList& properties)
-{
-    if (name == "property" || name == "Property") {
-        std::string key;
-        std::string value;
-
-        /* Collect all the <property> elements for the surrounding
-         * mayor element (like <settings> or <sprite>). When the
-         * surrounding element is closed, the results are handled
-         * in on_end_element(). */
-        for (xmlpp::SaxParser::AttributeList::const_iterator iter = properties.begin(); iter != properties.end(); iter++) {
-            xmlpp::SaxParser::Attribute attr = *iter;
-
-            if (attr.name == "name")
-                key = attr.value;
-            else if (attr.name == "value")
-                value = attr.value;
-        }
-
-        m_current_properties[key] = value;
-    }
-    else if (name == "script") {
-        // Indicate a script tag has opened, so we can retrieve
-        // its and only its text.
-        m_in_script_tag = true;
-    }
-}
-
-void cLevelLoader::on_end_element(const Glib::ustring& name)
+void cLevelLoader::Handle_Element(const std::string& name)
 {
-    // <property> tags are parsed cumulatively in on_start_element()
-    // so all have been collected when the surrounding element
-    // terminates here.
-    if (name == "property" || name == "Property")
-        return;
-
     // Now for the real, cumbersome parsing process
     if (name == "information")
         Parse_Tag_Information();
@@ -152,29 +124,13 @@ void cLevelLoader::on_end_element(const Glib::ustring& name)
         Parse_Tag_Background();
     else if (name == "player")
         Parse_Tag_Player();
-    else if (cLevel::Is_Level_Object_Element(std::string(name))) // CEGUI doesn’t like Glib::ustring
+    else if (cLevel::Is_Level_Object_Element(name))
         Parse_Level_Object_Tag(name);
     else if (name == "level") {
         /* Ignore the root <level> tag */
     }
-    else if (name == "script")
-        m_in_script_tag = false; // Indicate the <script> tag has ended
     else
         cerr << "Warning: Unknown XML tag '" << name << "'on level parsing." << endl;
-
-    // Everything handled, so we can now safely clear the
-    // collected <property> element values for the next
-    // tag.
-    m_current_properties.clear();
-}
-
-void cLevelLoader::on_characters(const Glib::ustring& text)
-{
-    /* If we’re currently in the <script> tag, read its
-     * text (may be called multiple times for each token,
-     * so append rather then set directly). */
-    if (m_in_script_tag)
-        mp_level->m_script.append(text);
 }
 
 /***************************************
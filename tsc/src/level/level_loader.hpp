@@ -17,6 +17,7 @@
 #define TSC_LEVEL_LOADER_HPP
 #include "../core/global_game.hpp"
 #include "../core/xml_attributes.hpp"
+#include "level_xml_parser.hpp"
 #include "level.hpp"
 
 namespace TSC {
@@ -37,8 +38,10 @@ namespace TSC {
      * Note that the cLevel instance returned by Get_Level() is NOT destroyed
      * when the cLevelLoader gets destroyed. It is handed to you for further
      * processing instead.
+     *
+     * The <property> and <script> handling is done by cLevel_XML_Parser.
      */
-    class cLevelLoader: public xmlpp::SaxParser {
+    class cLevelLoader: public cLevel_XML_Parser {
     public:
         // Takes the sprite’s main XML tag name, a list of parsed <property> elements
         // and the level’s engine version and creates a cSprite instance from that.
@@ -56,6 +59,8 @@ namespace TSC {
         // parse_file() that accepts a Glib::ustring — this function sets
         // some internal members.
         virtual void parse_file(boost::filesystem::path filename);
+        // Parse the already read contents of the given file.
+        virtual void parse_memory(boost::filesystem::path filename, const std::string& contents);
         // After finishing parsing, contains a pointer to a cLevel instance.
         // This pointer must be freed by you. Returns NULL before parsing.
         cLevel* Get_Level();
@@ -63,9 +68,7 @@ namespace TSC {
     protected: // SAX parser callbacks
         virtual void on_start_document();
         virtual void on_end_document();
-        virtual void on_start_element(const Glib::ustring& name, const xmlpp::SaxParser::AttributeList& properties);
-        virtual void on_end_element(const Glib::ustring& name);
-        virtual void on_characters(const Glib::ustring& text);
+        virtual void Handle_Element(const std::string& name);
 
     private:
         static std::vector<cSprite*> Create_Sprites_From_XML_Tag(const std::string& name, XmlAttributes& attributes, int engine_version, cSprite_Manager* p_sprite_manager);
@@ -96,12 +99,6 @@ namespace TSC {
         cLevel* mp_level;
         // The file we’re parsing
         boost::filesystem::path m_levelfile;
-        // The <property> results we found before the current tag. The
-        // value of the `name' attribute is mapped to the value of the
-        // `value' attribute. on_end_element() must clear this at its end.
-        XmlAttributes m_current_properties;
-        // True if we’re currently parsing a <script> tag.
-        bool m_in_script_tag;
     };
 
 }
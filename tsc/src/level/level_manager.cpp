@@ -31,6 +31,8 @@
 #include "../core/global_basic.hpp"
 #include "../gui/hud.hpp"
 #include "../gui/game_console.hpp"
+#include "../objects/level_exit.hpp"
+#include "level_preloader.hpp"
 
 using namespace std;
 
@@ -43,6 +45,7 @@ namespace TSC {
 cLevel_Manager::cLevel_Manager(void)
     : cObject_Manager<cLevel>()
 {
+    m_preloader = new cLevel_Preloader();
     m_camera = new cCamera(NULL);
 
     // set the first camera available
@@ -61,6 +64,7 @@ cLevel_Manager::~cLevel_Manager(void)
 {
     Delete_All();
     delete m_camera;
+    delete m_preloader;
 }
 
 void cLevel_Manager::Init(void)
@@ -132,7 +136,18 @@ cLevel* cLevel_Manager::Load(std::string levelname , bool loading_sublevel /* =
 
     // load
     fs::path filename = Get_Path(levelname);
-    level = cLevel::Load_From_File(filename);
+    std::string data;
+
+    // read in the background
+    if (!filename.empty() && m_preloader->Take_Level_Data(filename, data)) {
+        level = cLevel::Load_From_File(filename, &data);
+    }
+    else {
+        level = cLevel::Load_From_File(filename);
+    }
+
+    // preloaded images not taken by the level are not needed
+    m_preloader->Release(filename);
 
     Add(level);
     return level;
@@ -147,6 +162,8 @@ bool cLevel_Manager::Set_Active(cLevel* level)
     pActive_Level = level;
     gp_game_console->Reset();
 
+    Preload_Exits(level);
+
     return 1;
 }
 
@@ -163,6 +180,59 @@ cLevel* cLevel_Manager::Get(const std::string& levelname)
     return NULL;
 }
 
+void cLevel_Manager::Preload(const vector<std::string>& levelnames)
+{
+    vector<fs::path> filenames;
+
+    for (vector<std::string>::const_iterator itr = levelnames.begin(); itr != levelnames.end(); ++itr) {
+        // already loaded
+        if (itr->empty() || Get(*itr)) {
+            continue;
+        }
+
+        fs::path filename = Get_Path(*itr);
+
+        // only the supported level format
+        if (filename.extension() != fs::path(".tsclvl") && filename.extension() != fs::path(".smclvl")) {
+            continue;
+        }
+
+        if (std::find(filenames.begin(), filenames.end(), filename) == filenames.end()) {
+            filenames.push_back(filename);
+        }
+    }
+
+    m_preloader->Preload(filenames);
+}
+
+void cLevel_Manager::Preload_Exits(cLevel* level)
+{
+    // levels are edited
+    if (editor_enabled) {
+        m_preloader->Cancel();
+        return;
+    }
+
+    vector<std::string> levelnames;
+
+    for (cSprite_List::iterator itr = level->m_sprite_manager->objects.begin(); itr != level->m_sprite_manager->objects.end(); ++itr) {
+        cSprite* obj = (*itr);
+
+        if (obj->m_type != TYPE_LEVEL_EXIT) {
+            continue;
+        }
+
+        levelnames.push_back(static_cast<cLevel_Exit*>(obj)->Get_Level());
+    }
+
+    Preload(levelnames);
+}
+
+void cLevel_Manager::Cancel_Preload(void)
+{
+    m_preloader->Cancel();
+}
+
 fs::path cLevel_Manager::Get_Path(const std::string& levelname, bool check_only_user_dir /* = false */)
 {
     // Strip off directories and file extension (although we should
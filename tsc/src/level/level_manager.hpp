@@ -24,6 +24,8 @@
 
 namespace TSC {
 
+    class cLevel_Preloader;
+
 // default files for levels
 #define LEVEL_DEFAULT_MUSIC "land/land_5.ogg"
 #define LEVEL_DEFAULT_BACKGROUND "game/background/green_junglehills.png"
@@ -53,6 +55,16 @@ namespace TSC {
         bool Set_Active(cLevel* level);
         // Get level pointer
         cLevel* Get(const std::string& levelname);
+
+        /* Preload the given levels in the background
+         * Pending preloading of other levels is cancelled.
+         * Already loaded levels are skipped.
+        */
+        void Preload(const std::vector<std::string>& levelnames);
+        // Preload the destination levels of the level exits in the given level
+        void Preload_Exits(cLevel* level);
+        // Cancel pending preloading
+        void Cancel_Preload(void);
         /* Return the level path if level is valid else empty().
          * check_only_user_dir : only check user directory for the level and
          * skip levels included in the game.
@@ -80,6 +92,8 @@ namespace TSC {
 
         // level camera
         cCamera* m_camera;
+        // background level preloader
+        cLevel_Preloader* m_preloader;
     };
 
     /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
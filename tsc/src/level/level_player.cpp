@@ -117,6 +117,18 @@ cLevel_Player::cLevel_Player(cSprite_Manager* sprite_manager)
 
     m_is_warping = false;
 
+    m_sound_jump_small = -1;
+    m_sound_jump_small_power = -1;
+    m_sound_jump_ghost = -1;
+    m_sound_jump_big = -1;
+    m_sound_jump_big_power = -1;
+    m_sound_run_stop = -1;
+    m_sound_wall_hit = -1;
+    m_sound_fireball = -1;
+    m_sound_iceball = -1;
+    m_sound_fireball_explosion = -1;
+    m_sound_iceball_explosion = -1;
+
     Set_Pos(m_default_pos_x, m_default_pos_y, 1);
 }
 
@@ -134,6 +146,7 @@ cLevel_Player* cLevel_Player::Copy(void) const
 void cLevel_Player::Init(void)
 {
     Load_Images();
+    Load_Sounds();
     // default direction : right
     Set_Direction(DIR_RIGHT, 1);
     // default uid 0
@@ -220,7 +233,7 @@ void cLevel_Player::DownGrade_Player(bool delayed /* = true */, bool force /* =
 
     // if not weakest state or not forced
     if (m_alex_type != ALEX_SMALL && !force) {
-        pAudio->Play_Sound("player/powerdown.ogg", RID_ALEX_POWERDOWN);
+        pAudio->Play_Sound("player/powerdown.ogg", RID_ALEX_POWERDOWN, -1, false, SOUND_PRIORITY_HIGH);
 
         // power down
         Set_Type(ALEX_SMALL);
@@ -260,11 +273,11 @@ void cLevel_Player::DownGrade_Player(bool delayed /* = true */, bool force /* =
 
     // lost a live
     if (gp_hud->Get_Lives() >= 0) {
-        pAudio->Play_Sound(utf8_to_path("player/dead.ogg"), RID_ALEX_DEATH);
+        pAudio->Play_Sound(utf8_to_path("player/dead.ogg"), RID_ALEX_DEATH, -1, false, SOUND_PRIORITY_HIGH);
     }
     // game over
     else {
-        pAudio->Play_Sound(pResource_Manager->Get_Game_Music("game/lost_1.ogg"), RID_ALEX_DEATH);
+        pAudio->Play_Sound(pResource_Manager->Get_Game_Music("game/lost_1.ogg"), RID_ALEX_DEATH, -1, false, SOUND_PRIORITY_HIGH);
     }
 
     // dying animation
@@ -1165,23 +1178,23 @@ void cLevel_Player::Start_Jump(float deaccel /* = 0.08f */)
         // small
         if (m_alex_type == ALEX_SMALL) {
             if (m_force_jump) {
-                pAudio->Play_Sound("player/jump_small_power.ogg", RID_ALEX_JUMP);
+                pAudio->Play_Sound_Handle(m_sound_jump_small_power, RID_ALEX_JUMP);
             }
             else {
-                pAudio->Play_Sound("player/jump_small.ogg", RID_ALEX_JUMP);
+                pAudio->Play_Sound_Handle(m_sound_jump_small, RID_ALEX_JUMP);
             }
         }
         // ghost
         else if (m_alex_type == ALEX_GHOST) {
-            pAudio->Play_Sound("player/jump_ghost.ogg", RID_ALEX_JUMP);
+            pAudio->Play_Sound_Handle(m_sound_jump_ghost, RID_ALEX_JUMP);
         }
         // big
         else {
             if (m_force_jump) {
-                pAudio->Play_Sound("player/jump_big_power.ogg", RID_ALEX_JUMP);
+                pAudio->Play_Sound_Handle(m_sound_jump_big_power, RID_ALEX_JUMP);
             }
             else {
-                pAudio->Play_Sound("player/jump_big.ogg", RID_ALEX_JUMP);
+                pAudio->Play_Sound_Handle(m_sound_jump_big, RID_ALEX_JUMP);
             }
         }
     }
@@ -2692,6 +2705,21 @@ void cLevel_Player::Load_Images(void)
     Set_Image_Num(Get_Image() + m_direction);
 }
 
+void cLevel_Player::Load_Sounds(void)
+{
+    m_sound_jump_small = pAudio->Get_Sound_Handle("player/jump_small.ogg");
+    m_sound_jump_small_power = pAudio->Get_Sound_Handle("player/jump_small_power.ogg");
+    m_sound_jump_ghost = pAudio->Get_Sound_Handle("player/jump_ghost.ogg");
+    m_sound_jump_big = pAudio->Get_Sound_Handle("player/jump_big.ogg");
+    m_sound_jump_big_power = pAudio->Get_Sound_Handle("player/jump_big_power.ogg");
+    m_sound_run_stop = pAudio->Get_Sound_Handle("player/run_stop.ogg");
+    m_sound_wall_hit = pAudio->Get_Sound_Handle("wall_hit.wav");
+    m_sound_fireball = pAudio->Get_Sound_Handle("item/fireball.ogg");
+    m_sound_iceball = pAudio->Get_Sound_Handle("item/iceball.wav");
+    m_sound_fireball_explosion = pAudio->Get_Sound_Handle("item/fireball_explosion.wav");
+    m_sound_iceball_explosion = pAudio->Get_Sound_Handle("item/iceball_explosion.wav");
+}
+
 void cLevel_Player::Get_Item(SpriteType item_type, bool force /* = 0 */, cMovingSprite* base /* = NULL */)
 {
     Alex_type current_alex_type;
@@ -3056,7 +3084,7 @@ void cLevel_Player::Action_Interact(input_identifier key_type)
             if (m_direction != DIR_LEFT) {
                 // play stop sound if already running
                 if (m_velx > 12.0f && m_ground_object) {
-                    pAudio->Play_Sound("player/run_stop.ogg", RID_ALEX_STOP);
+                    pAudio->Play_Sound_Handle(m_sound_run_stop, RID_ALEX_STOP);
                 }
 
                 m_direction = DIR_LEFT;
@@ -3104,7 +3132,7 @@ void cLevel_Player::Action_Interact(input_identifier key_type)
             if (m_direction != DIR_RIGHT) {
                 // play stop sound if already running
                 if (m_velx < -12.0f && m_ground_object) {
-                    pAudio->Play_Sound("player/run_stop.ogg", RID_ALEX_STOP);
+                    pAudio->Play_Sound_Handle(m_sound_run_stop, RID_ALEX_STOP);
                 }
 
                 m_direction = DIR_RIGHT;
@@ -3244,12 +3272,12 @@ bool cLevel_Player::Ball_Add(ball_effect effect_type /* = FIREBALL_DEFAULT */, f
             ball_vel_x = 12;
 
             // sound
-            pAudio->Play_Sound("item/iceball.wav", RID_ALEX_BALL);
+            pAudio->Play_Sound_Handle(m_sound_iceball, RID_ALEX_BALL);
         }
         // fireball
         else {
             // sound
-            pAudio->Play_Sound("item/fireball.ogg", RID_ALEX_BALL);
+            pAudio->Play_Sound_Handle(m_sound_fireball, RID_ALEX_BALL);
         }
 
         if (m_direction == DIR_LEFT) {
@@ -3322,7 +3350,7 @@ bool cLevel_Player::Ball_Add(ball_effect effect_type /* = FIREBALL_DEFAULT */, f
             anim->Set_Fading_Speed(0.3f);
             pActive_Animation_Manager->Add(anim);
 
-            pAudio->Play_Sound("item/fireball_explosion.wav", RID_ALEX_BALL);
+            pAudio->Play_Sound_Handle(m_sound_fireball_explosion, RID_ALEX_BALL);
         }
         else {
             // create animation
@@ -3339,7 +3367,7 @@ bool cLevel_Player::Ball_Add(ball_effect effect_type /* = FIREBALL_DEFAULT */, f
             anim->Emit();
             pActive_Animation_Manager->Add(anim);
 
-            pAudio->Play_Sound("item/iceball_explosion.wav", RID_ALEX_BALL);
+            pAudio->Play_Sound_Handle(m_sound_iceball_explosion, RID_ALEX_BALL);
         }
     }
     // unknown type
@@ -3797,7 +3825,7 @@ void cLevel_Player::Handle_Collision_Massive(cObjectCollision* collision)
                 }
 
                 if (collision->m_array == ARRAY_MASSIVE) {
-                    pAudio->Play_Sound("wall_hit.wav", RID_ALEX_WALL_HIT);
+                    pAudio->Play_Sound_Handle(m_sound_wall_hit, RID_ALEX_WALL_HIT);
 
                     // create animation
                     cParticle_Emitter* anim = new cParticle_Emitter(m_sprite_manager);
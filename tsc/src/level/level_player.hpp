@@ -185,6 +185,8 @@ namespace TSC {
 
         // Loads the images depending on alex_type
         void Load_Images(void);
+        // Get the handles of the often played sounds
+        void Load_Sounds(void);
 
         /* Sets the best position to advance in size
          * if only_check is set position is unchanged
@@ -345,6 +347,19 @@ namespace TSC {
         // Are we going through a level exit/level entry right now?
         bool m_is_warping;
 
+        // often played sound handles
+        int m_sound_jump_small;
+        int m_sound_jump_small_power;
+        int m_sound_jump_ghost;
+        int m_sound_jump_big;
+        int m_sound_jump_big_power;
+        int m_sound_run_stop;
+        int m_sound_wall_hit;
+        int m_sound_fireball;
+        int m_sound_iceball;
+        int m_sound_fireball_explosion;
+        int m_sound_iceball_explosion;
+
         // default position
         static const float m_default_pos_x;
         static const float m_default_pos_y;
@@ -0,0 +1,504 @@
+/***************************************************************************
+ * level_preloader.cpp  -  background preloading of levels
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "level_preloader.hpp"
+#include "../core/filesystem/filesystem.hpp"
+#include "../core/filesystem/resource_manager.hpp"
+#include "../video/img_settings.hpp"
+#include "../video/img_manager.hpp"
+
+using namespace std;
+
+namespace fs = boost::filesystem;
+
+namespace TSC {
+
+// default memory budget for file data and decoded images
+static const size_t level_preload_budget = 96 * 1024 * 1024;
+
+/* *** *** *** *** *** cLevel_Image_Scanner *** *** *** *** *** *** *** *** *** *** *** *** */
+
+/* Collects the image properties of a level file
+ * Unlike cLevelLoader it does not create any objects and is therefore
+ * safe to use outside of the main thread.
+*/
+class cLevel_Image_Scanner : public xmlpp::SaxParser {
+public:
+    vector<string> m_images;
+protected:
+    virtual void on_start_element(const Glib::ustring& name, const xmlpp::SaxParser::AttributeList& properties);
+};
+
+void cLevel_Image_Scanner::on_start_element(const Glib::ustring& name, const xmlpp::SaxParser::AttributeList& properties)
+{
+    if (name != "property" && name != "Property") {
+        return;
+    }
+
+    string key;
+    string value;
+
+    for (xmlpp::SaxParser::AttributeList::const_iterator iter = properties.begin(); iter != properties.end(); iter++) {
+        if (iter->name == "name") {
+            key = iter->value;
+        }
+        else if (iter->name == "value") {
+            value = iter->value;
+        }
+    }
+
+    if (key == "image" && !value.empty()) {
+        m_images.push_back(value);
+    }
+}
+
+/* *** *** *** *** *** cPreload_Level *** *** *** *** *** *** *** *** *** *** *** *** */
+
+cPreload_Level::cPreload_Level(const fs::path& filename)
+    : m_filename(filename)
+{
+    m_write_time = 0;
+    m_next_image = 0;
+    m_state = PRELOAD_QUEUED;
+    m_memory = 0;
+}
+
+/* *** *** *** *** *** cLevel_Preloader *** *** *** *** *** *** *** *** *** *** *** *** */
+
+cLevel_Preloader::cLevel_Preloader(void)
+{
+    m_budget = level_preload_budget;
+    m_quit = 0;
+    m_memory = 0;
+
+    m_thread = boost::thread(&cLevel_Preloader::Worker, this);
+}
+
+cLevel_Preloader::~cLevel_Preloader(void)
+{
+    {
+        boost::lock_guard<boost::mutex> lock(m_mutex);
+        m_quit = 1;
+    }
+
+    m_condition.notify_one();
+
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+
+    Clear();
+}
+
+void cLevel_Preloader::Preload(const vector<fs::path>& filenames)
+{
+    {
+        boost::lock_guard<boost::mutex> lock(m_mutex);
+
+        m_pixmaps_dir = pResource_Manager->Get_Game_Pixmaps_Directory();
+
+        // cancel the levels not requested anymore
+        for (list<cPreload_Level_Ptr>::iterator itr = m_levels.begin(); itr != m_levels.end();) {
+            cPreload_Level_Ptr level = (*itr);
+
+            if (std::find(filenames.begin(), filenames.end(), level->m_filename) != filenames.end()) {
+                ++itr;
+                continue;
+            }
+
+            // nothing preloaded yet
+            if (level->m_state == PRELOAD_QUEUED) {
+                list<cPreload_Level_Ptr>::iterator next = itr;
+                ++next;
+                Remove_Level(itr);
+                itr = next;
+                continue;
+            }
+
+            // keep what is already there
+            level->m_state = PRELOAD_DONE;
+            ++itr;
+        }
+
+        // move the requested levels to the front in the given order
+        for (vector<fs::path>::const_reverse_iterator itr = filenames.rbegin(); itr != filenames.rend(); ++itr) {
+            list<cPreload_Level_Ptr>::iterator found = Find_Level(*itr);
+            cPreload_Level_Ptr level;
+
+            if (found != m_levels.end()) {
+                level = (*found);
+                m_levels.erase(found);
+
+                // resume a cancelled level
+                if (level->m_state == PRELOAD_DONE && !level->m_data.empty() && level->m_next_image < level->m_images.size()) {
+                    level->m_state = PRELOAD_DECODING;
+                }
+            }
+            else {
+                level = cPreload_Level_Ptr(new cPreload_Level(*itr));
+            }
+
+            m_levels.push_front(level);
+        }
+    }
+
+    m_condition.notify_one();
+}
+
+void cLevel_Preloader::Cancel(void)
+{
+    boost::lock_guard<boost::mutex> lock(m_mutex);
+
+    for (list<cPreload_Level_Ptr>::iterator itr = m_levels.begin(); itr != m_levels.end();) {
+        if ((*itr)->m_state == PRELOAD_QUEUED) {
+            list<cPreload_Level_Ptr>::iterator next = itr;
+            ++next;
+            Remove_Level(itr);
+            itr = next;
+            continue;
+        }
+
+        (*itr)->m_state = PRELOAD_DONE;
+        ++itr;
+    }
+}
+
+void cLevel_Preloader::Clear(void)
+{
+    boost::lock_guard<boost::mutex> lock(m_mutex);
+
+    while (!m_levels.empty()) {
+        Remove_Level(m_levels.begin());
+    }
+}
+
+void cLevel_Preloader::Update(void)
+{
+    bool new_work = 0;
+
+    {
+        boost::lock_guard<boost::mutex> lock(m_mutex);
+
+        for (list<cPreload_Level_Ptr>::iterator itr = m_levels.begin(); itr != m_levels.end(); ++itr) {
+            cPreload_Level_Ptr level = (*itr);
+
+            if (level->m_state != PRELOAD_SCANNED) {
+                continue;
+            }
+
+            // the image manager is only safe to use from the main thread
+            for (vector<string>::const_iterator img_itr = level->m_referenced_images.begin(); img_itr != level->m_referenced_images.end(); ++img_itr) {
+                fs::path filename = utf8_to_path(*img_itr);
+
+                // same filename as cVideo::Get_Surface uses
+                if (filename.extension() == fs::path(".settings")) {
+                    filename.replace_extension(".png");
+                }
+                if (!filename.is_absolute()) {
+                    filename = m_pixmaps_dir / filename;
+                }
+
+                // already loaded or preloaded
+                if (pImage_Manager->Get_Pointer(filename) || m_images.count(path_to_utf8(filename))) {
+                    continue;
+                }
+                if (std::find(level->m_images.begin(), level->m_images.end(), filename) != level->m_images.end()) {
+                    continue;
+                }
+
+                level->m_images.push_back(filename);
+            }
+
+            level->m_referenced_images.clear();
+            level->m_state = level->m_images.empty() ? PRELOAD_DONE : PRELOAD_DECODING;
+            new_work = 1;
+        }
+    }
+
+    if (new_work) {
+        m_condition.notify_one();
+    }
+}
+
+bool cLevel_Preloader::Take_Level_Data(const fs::path& filename, string& data)
+{
+    boost::lock_guard<boost::mutex> lock(m_mutex);
+
+    list<cPreload_Level_Ptr>::iterator itr = Find_Level(filename);
+
+    if (itr == m_levels.end()) {
+        return 0;
+    }
+
+    cPreload_Level_Ptr level = (*itr);
+
+    // not read yet or already taken
+    if (level->m_data.empty()) {
+        return 0;
+    }
+
+    // changed since it was read
+    boost::system::error_code error;
+    if (fs::last_write_time(filename, error) != level->m_write_time || error) {
+        Remove_Level(itr);
+        return 0;
+    }
+
+    m_memory -= level->m_data.size();
+    level->m_memory -= level->m_data.size();
+    data.swap(level->m_data);
+    level->m_data.clear();
+
+    // the remaining images are loaded by the caller now
+    level->m_state = PRELOAD_DONE;
+
+    return 1;
+}
+
+bool cLevel_Preloader::Take_Image(const fs::path& filename, cVideo::cSoftware_Image& software_image)
+{
+    boost::lock_guard<boost::mutex> lock(m_mutex);
+
+    PreloadImageMap::iterator itr = m_images.find(path_to_utf8(filename));
+
+    if (itr == m_images.end()) {
+        return 0;
+    }
+
+    software_image = itr->second.m_software_image;
+    m_memory -= itr->second.m_memory;
+    itr->second.m_level->m_memory -= itr->second.m_memory;
+    m_images.erase(itr);
+
+    return 1;
+}
+
+void cLevel_Preloader::Release(const fs::path& filename)
+{
+    boost::lock_guard<boost::mutex> lock(m_mutex);
+
+    list<cPreload_Level_Ptr>::iterator itr = Find_Level(filename);
+
+    if (itr != m_levels.end()) {
+        Remove_Level(itr);
+    }
+}
+
+void cLevel_Preloader::Worker(void)
+{
+    // settings parser of this thread
+    cImage_Settings_Parser settings_parser;
+
+    boost::unique_lock<boost::mutex> lock(m_mutex);
+
+    while (!m_quit) {
+        cPreload_Level_Ptr level;
+
+        // read the level files first as they are cheap and needed for the image list
+        for (list<cPreload_Level_Ptr>::iterator itr = m_levels.begin(); itr != m_levels.end(); ++itr) {
+            if ((*itr)->m_state == PRELOAD_QUEUED) {
+                level = (*itr);
+                break;
+            }
+        }
+
+        if (level) {
+            Read_Level(level, lock);
+            continue;
+        }
+
+        for (list<cPreload_Level_Ptr>::iterator itr = m_levels.begin(); itr != m_levels.end(); ++itr) {
+            if ((*itr)->m_state == PRELOAD_DECODING) {
+                level = (*itr);
+                break;
+            }
+        }
+
+        if (level) {
+            Decode_Image(level, lock, settings_parser);
+            continue;
+        }
+
+        m_condition.wait(lock);
+    }
+}
+
+void cLevel_Preloader::Read_Level(cPreload_Level_Ptr level, boost::unique_lock<boost::mutex>& lock)
+{
+    lock.unlock();
+
+    string data;
+    cLevel_Image_Scanner scanner;
+    boost::system::error_code error;
+    time_t write_time = fs::last_write_time(level->m_filename, error);
+
+    if (!error) {
+        fs::ifstream file(level->m_filename, ios::in | ios::binary);
+        data.assign(istreambuf_iterator<char>(file), istreambuf_iterator<char>());
+
+        try {
+            scanner.parse_memory(data);
+        }
+        catch (const std::exception& e) {
+            cerr << "Warning : Preloading level " << path_to_utf8(level->m_filename) << " failed : " << e.what() << endl;
+            data.clear();
+        }
+    }
+
+    lock.lock();
+
+    // cancelled meanwhile
+    if (level->m_state != PRELOAD_QUEUED) {
+        return;
+    }
+
+    if (data.empty() || !Make_Room(data.size(), level.get())) {
+        level->m_state = PRELOAD_DONE;
+        return;
+    }
+
+    level->m_write_time = write_time;
+    level->m_data.swap(data);
+    level->m_referenced_images.swap(scanner.m_images);
+    level->m_memory += level->m_data.size();
+    m_memory += level->m_data.size();
+    level->m_state = PRELOAD_SCANNED;
+}
+
+void cLevel_Preloader::Decode_Image(cPreload_Level_Ptr level, boost::unique_lock<boost::mutex>& lock, cImage_Settings_Parser& settings_parser)
+{
+    // all done
+    if (level->m_next_image >= level->m_images.size()) {
+        level->m_state = PRELOAD_DONE;
+        return;
+    }
+
+    fs::path filename = level->m_images[level->m_next_image];
+    level->m_next_image++;
+
+    // preloaded for another level
+    if (m_images.count(path_to_utf8(filename))) {
+        return;
+    }
+
+    lock.unlock();
+    cVideo::cSoftware_Image software_image = pVideo->Load_Image(filename, 1, 0, &settings_parser);
+    lock.lock();
+
+    if (!software_image.m_sf_image) {
+        return;
+    }
+
+    size_t size = software_image.m_sf_image->getSize().x * software_image.m_sf_image->getSize().y * 4;
+
+    // cancelled meanwhile or preloaded for another level
+    if (level->m_state != PRELOAD_DECODING || m_images.count(path_to_utf8(filename))) {
+        delete software_image.m_sf_image;
+        delete software_image.m_settings;
+        return;
+    }
+
+    // over the budget, stop preloading this level
+    if (!Make_Room(size, level.get())) {
+        delete software_image.m_sf_image;
+        delete software_image.m_settings;
+        level->m_state = PRELOAD_DONE;
+        return;
+    }
+
+    cPreload_Image& image = m_images[path_to_utf8(filename)];
+    image.m_software_image = software_image;
+    image.m_memory = size;
+    image.m_level = level.get();
+
+    level->m_memory += size;
+    m_memory += size;
+}
+
+list<cPreload_Level_Ptr>::iterator cLevel_Preloader::Find_Level(const fs::path& filename)
+{
+    for (list<cPreload_Level_Ptr>::iterator itr = m_levels.begin(); itr != m_levels.end(); ++itr) {
+        if ((*itr)->m_filename == filename) {
+            return itr;
+        }
+    }
+
+    return m_levels.end();
+}
+
+void cLevel_Preloader::Remove_Level(list<cPreload_Level_Ptr>::iterator itr)
+{
+    cPreload_Level_Ptr level = (*itr);
+
+    // stop the worker if it is busy with it
+    level->m_state = PRELOAD_DONE;
+
+    for (PreloadImageMap::iterator img_itr = m_images.begin(); img_itr != m_images.end();) {
+        if (img_itr->second.m_level == level.get()) {
+            PreloadImageMap::iterator next = img_itr;
+            ++next;
+            Free_Image(img_itr);
+            img_itr = next;
+            continue;
+        }
+
+        ++img_itr;
+    }
+
+    m_memory -= level->m_data.size();
+    level->m_memory = 0;
+    level->m_data.clear();
+    m_levels.erase(itr);
+}
+
+void cLevel_Preloader::Free_Image(PreloadImageMap::iterator itr)
+{
+    delete itr->second.m_software_image.m_sf_image;
+    delete itr->second.m_software_image.m_settings;
+
+    m_memory -= itr->second.m_memory;
+    itr->second.m_level->m_memory -= itr->second.m_memory;
+    m_images.erase(itr);
+}
+
+bool cLevel_Preloader::Make_Room(size_t size, const cPreload_Level* keep)
+{
+    if (size > m_budget) {
+        return 0;
+    }
+
+    // evict the least recently requested levels
+    while (m_memory + size > m_budget) {
+        list<cPreload_Level_Ptr>::iterator victim = m_levels.end();
+
+        for (list<cPreload_Level_Ptr>::iterator itr = m_levels.begin(); itr != m_levels.end(); ++itr) {
+            if ((*itr).get() != keep && (*itr)->m_memory > 0) {
+                victim = itr;
+            }
+        }
+
+        if (victim == m_levels.end()) {
+            return 0;
+        }
+
+        Remove_Level(victim);
+    }
+
+    return 1;
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
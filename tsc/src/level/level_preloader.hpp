@@ -0,0 +1,149 @@
+/***************************************************************************
+ * level_preloader.hpp
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_LEVEL_PRELOADER_HPP
+#define TSC_LEVEL_PRELOADER_HPP
+
+#include "../core/global_basic.hpp"
+#include "../video/video.hpp"
+#include <list>
+#include <memory>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+
+namespace TSC {
+
+    /* *** *** *** *** *** Preload state *** *** *** *** *** *** *** *** *** *** *** *** */
+
+    enum Preload_State {
+        PRELOAD_QUEUED = 0,     // waiting for the worker to read the level file
+        PRELOAD_SCANNED = 1,    // file read, image list waits for the main thread filter
+        PRELOAD_DECODING = 2,   // worker decodes the images
+        PRELOAD_DONE = 3        // finished, failed or cancelled
+    };
+
+    /* *** *** *** *** *** cPreload_Level *** *** *** *** *** *** *** *** *** *** *** *** */
+
+    class cPreload_Level {
+    public:
+        cPreload_Level(const boost::filesystem::path& filename);
+
+        // level file
+        boost::filesystem::path m_filename;
+        // modification time of the file when it was read
+        std::time_t m_write_time;
+        // level file contents
+        std::string m_data;
+        // images referenced by the level as written in the file
+        std::vector<std::string> m_referenced_images;
+        // absolute image filenames left to decode
+        std::vector<boost::filesystem::path> m_images;
+        // next image in m_images to decode
+        size_t m_next_image;
+        Preload_State m_state;
+        // memory used by the file data and the decoded images of this level
+        size_t m_memory;
+    };
+
+    typedef std::shared_ptr<cPreload_Level> cPreload_Level_Ptr;
+
+    /* *** *** *** *** *** cLevel_Preloader *** *** *** *** *** *** *** *** *** *** *** *** */
+
+    /* Speculatively reads levels and decodes their images on a worker thread
+     * The worker only produces file data and software images. Building the
+     * sprites and uploading the textures stays on the main thread, which takes
+     * the prepared data when the level is really loaded.
+     * Preloaded levels are kept in least recently requested order and evicted
+     * when the memory budget is exceeded.
+    */
+    class cLevel_Preloader {
+    public:
+        cLevel_Preloader(void);
+        ~cLevel_Preloader(void);
+
+        /* Set the levels to preload
+         * Pending work for levels not in the list is cancelled. Already
+         * preloaded levels stay cached until evicted.
+        */
+        void Preload(const std::vector<boost::filesystem::path>& filenames);
+        // Cancel all pending work but keep what is already preloaded
+        void Cancel(void);
+        // Cancel all pending work and free all preloaded data
+        void Clear(void);
+        // Hand the scanned images to the worker. Must be called from the main thread.
+        void Update(void);
+
+        /* Take the preloaded contents of the level file
+         * Stops decoding further images of this level.
+         * Returns false if the file was not read yet or changed since.
+        */
+        bool Take_Level_Data(const boost::filesystem::path& filename, std::string& data);
+        /* Take a preloaded image as returned by cVideo::Load_Image with settings
+         * The image and settings are owned by the caller afterwards.
+        */
+        bool Take_Image(const boost::filesystem::path& filename, cVideo::cSoftware_Image& software_image);
+        // Drop the level and its remaining images
+        void Release(const boost::filesystem::path& filename);
+
+        // memory budget in bytes
+        size_t m_budget;
+    private:
+        class cPreload_Image {
+        public:
+            cVideo::cSoftware_Image m_software_image;
+            size_t m_memory;
+            // level which requested the image
+            cPreload_Level* m_level;
+        };
+        typedef std::unordered_map<std::string, cPreload_Image> PreloadImageMap;
+
+        // worker thread function
+        void Worker(void);
+        /* read and scan the level file
+         * lock is released while reading
+        */
+        void Read_Level(cPreload_Level_Ptr level, boost::unique_lock<boost::mutex>& lock);
+        /* decode the next image of the level
+         * lock is released while decoding
+        */
+        void Decode_Image(cPreload_Level_Ptr level, boost::unique_lock<boost::mutex>& lock, cImage_Settings_Parser& settings_parser);
+
+        // the following require m_mutex to be locked
+        std::list<cPreload_Level_Ptr>::iterator Find_Level(const boost::filesystem::path& filename);
+        void Remove_Level(std::list<cPreload_Level_Ptr>::iterator itr);
+        void Free_Image(PreloadImageMap::iterator itr);
+        // evict least recently requested levels until size fits, returns false if it can not fit
+        bool Make_Room(size_t size, const cPreload_Level* keep);
+
+        boost::thread m_thread;
+        boost::mutex m_mutex;
+        boost::condition_variable m_condition;
+        bool m_quit;
+
+        // most recently requested first
+        std::list<cPreload_Level_Ptr> m_levels;
+        // decoded images by absolute filename
+        PreloadImageMap m_images;
+        // used memory of all levels
+        size_t m_memory;
+        // pixmaps directory copied from the resource manager on the main thread
+        boost::filesystem::path m_pixmaps_dir;
+    };
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
@@ -0,0 +1,104 @@
+/***************************************************************************
+ * level_xml_parser.cpp - SAX parsing of level XML
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "level_xml_parser.hpp"
+
+using namespace std;
+
+namespace TSC {
+
+/* *** *** *** *** *** cLevel_XML_Parser *** *** *** *** *** *** *** *** *** *** *** *** */
+
+cLevel_XML_Parser::cLevel_XML_Parser(void)
+    : xmlpp::SaxParser()
+{
+    m_in_script_tag = 0;
+}
+
+cLevel_XML_Parser::~cLevel_XML_Parser(void)
+{
+    //
+}
+
+void cLevel_XML_Parser::on_start_document()
+{
+    m_script.clear();
+    m_current_properties.clear();
+    m_in_script_tag = 0;
+}
+
+void cLevel_XML_Parser::on_start_element(const Glib::ustring& name, const xmlpp::SaxParser::AttributeList& properties)
+{
+    if (name == "property" || name == "Property") {
+        std::string key;
+        std::string value;
+
+        /* Collect all the <property> elements for the surrounding
+         * mayor element (like <settings> or <sprite>). When the
+         * surrounding element is closed, the results are handled
+         * in on_end_element(). */
+        for (xmlpp::SaxParser::AttributeList::const_iterator iter = properties.begin(); iter != properties.end(); iter++) {
+            if (iter->name == "name") {
+                key = iter->value;
+            }
+            else if (iter->name == "value") {
+                value = iter->value;
+            }
+        }
+
+        m_current_properties[key] = value;
+    }
+    else if (name == "script") {
+        // Indicate a script tag has opened, so we can retrieve
+        // its and only its text.
+        m_in_script_tag = 1;
+    }
+}
+
+void cLevel_XML_Parser::on_end_element(const Glib::ustring& name)
+{
+    // <property> tags are parsed cumulatively in on_start_element()
+    // so all have been collected when the surrounding element
+    // terminates here.
+    if (name == "property" || name == "Property") {
+        return;
+    }
+
+    if (name == "script") {
+        m_in_script_tag = 0;
+    }
+    else {
+        Handle_Element(name);
+    }
+
+    // Everything handled, so we can now safely clear the
+    // collected <property> element values for the next
+    // tag.
+    m_current_properties.clear();
+}
+
+void cLevel_XML_Parser::on_characters(const Glib::ustring& text)
+{
+    /* If we’re currently in the <script> tag, read its
+     * text (may be called multiple times for each token,
+     * so append rather then set directly). */
+    if (m_in_script_tag) {
+        m_script.append(text);
+    }
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
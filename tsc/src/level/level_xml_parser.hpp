@@ -0,0 +1,65 @@
+/***************************************************************************
+ * level_xml_parser.hpp - SAX parsing of level XML
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_LEVEL_XML_PARSER_HPP
+#define TSC_LEVEL_XML_PARSER_HPP
+
+#include "../core/global_basic.hpp"
+#include "../core/xml_attributes.hpp"
+
+namespace TSC {
+
+    /* *** *** *** *** *** cLevel_XML_Parser *** *** *** *** *** *** *** *** *** *** *** *** */
+
+    /* The XML side of level loading
+     * Collects the <property> elements of each major element like <settings>
+     * or <sprite> and the text of the <script> tags. What to do with an element
+     * is left to the subclass, so it does not need an OpenGL context itself.
+    */
+    class cLevel_XML_Parser : public xmlpp::SaxParser {
+    public:
+        cLevel_XML_Parser(void);
+        virtual ~cLevel_XML_Parser(void);
+
+        // text of the <script> tags
+        std::string m_script;
+
+    protected:
+        /* Called when a major element ends with its properties in m_current_properties
+         * not called for <property> and <script>
+        */
+        virtual void Handle_Element(const std::string& name) = 0;
+
+        // SAX parser callbacks
+        virtual void on_start_document();
+        virtual void on_start_element(const Glib::ustring& name, const xmlpp::SaxParser::AttributeList& properties);
+        virtual void on_end_element(const Glib::ustring& name);
+        virtual void on_characters(const Glib::ustring& text);
+
+        // The <property> results found before the current tag. The
+        // value of the `name' attribute is mapped to the value of the
+        // `value' attribute. Cleared after Handle_Element().
+        XmlAttributes m_current_properties;
+
+    private:
+        // True if we’re currently parsing a <script> tag.
+        bool m_in_script_tag;
+    };
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
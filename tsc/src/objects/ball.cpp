@@ -34,6 +34,19 @@ namespace TSC {
 
 /* *** *** *** *** *** *** cBall *** *** *** *** *** *** *** *** *** *** *** */
 
+// often played sound handles, looked up once
+static int Get_Fireball_Explode_Sound(void)
+{
+    static const int handle = pAudio->Get_Sound_Handle("item/fireball_explode.wav");
+    return handle;
+}
+
+static int Get_Fireball_Repelled_Sound(void)
+{
+    static const int handle = pAudio->Get_Sound_Handle("item/fireball_repelled.wav");
+    return handle;
+}
+
 cBall::cBall(cSprite_Manager* sprite_manager)
     : cMovingSprite(sprite_manager, "ball")
 {
@@ -77,6 +90,8 @@ void cBall::Init(void)
 
     Set_Spawned(1);
     m_camera_range = 2000;
+    // destroys itself when out of range
+    m_always_active = 1;
 
     m_massive_type = MASS_MASSIVE;
 
@@ -152,7 +167,7 @@ void cBall::Destroy_Ball(bool with_sound /* = 0 */)
 {
     if (with_sound) {
         if (m_ball_type == FIREBALL_DEFAULT) {
-            pAudio->Play_Sound("item/fireball_explode.wav");
+            pAudio->Play_Sound_Handle(Get_Fireball_Explode_Sound());
         }
     }
 
@@ -382,7 +397,7 @@ void cBall::Handle_Collision_Player(cObjectCollision* collision)
         }
     }
 
-    pAudio->Play_Sound("item/fireball_repelled.wav");
+    pAudio->Play_Sound_Handle(Get_Fireball_Repelled_Sound());
     Destroy();
 }
 
@@ -392,7 +407,7 @@ void cBall::Handle_Collision_Enemy(cObjectCollision* collision)
 
     // if enemy is not vulnerable
     if ((m_ball_type == FIREBALL_DEFAULT && enemy->m_fire_resistant) || (m_ball_type == ICEBALL_DEFAULT && enemy->m_ice_resistance >= 1)) {
-        pAudio->Play_Sound("item/fireball_repelled.wav");
+        pAudio->Play_Sound_Handle(Get_Fireball_Repelled_Sound());
     }
     // make enemy handle the ball
     else {
@@ -44,6 +44,13 @@ namespace TSC {
 
 /* *** *** *** *** *** *** *** *** cBaseBox *** *** *** *** *** *** *** *** *** */
 
+// often played sound handle, looked up once
+static int Get_Wall_Hit_Sound(void)
+{
+    static const int handle = pAudio->Get_Sound_Handle("wall_hit.wav");
+    return handle;
+}
+
 cBaseBox::cBaseBox(cSprite_Manager* sprite_manager)
     : cMovingSprite(sprite_manager, "box")
 {
@@ -626,7 +633,7 @@ void cBaseBox::Handle_Collision_Player(cObjectCollision* collision)
         }
         else {
             if (Is_Visible_On_Screen()) {
-                pAudio->Play_Sound("wall_hit.wav", RID_ALEX_WALL_HIT);
+                pAudio->Play_Sound_Handle(Get_Wall_Hit_Sound(), RID_ALEX_WALL_HIT);
             }
         }
     }
@@ -665,7 +672,7 @@ void cBaseBox::Handle_Collision_Enemy(cObjectCollision* collision)
         }
         else {
             if (Is_Visible_On_Screen()) {
-                pAudio->Play_Sound("wall_hit.wav");
+                pAudio->Play_Sound_Handle(Get_Wall_Hit_Sound());
             }
         }
     }
@@ -133,6 +133,9 @@ void cGoldpiece::Set_Gold_Color(DefaultColor color)
     else {
         Set_Animation_Speed(1.0);
     }
+
+    // only animates but random frames use the global rand()
+    m_thread_safe_update = m_type == TYPE_GOLDPIECE && !Has_Random_Frames();
 }
 
 void cGoldpiece::Activate(void)
@@ -243,6 +246,9 @@ cJGoldpiece::cJGoldpiece(cSprite_Manager* sprite_manager, DefaultColor color /*
 {
     m_type = TYPE_JUMPING_GOLDPIECE;
     Set_Spawned(1);
+    // the animation always finishes
+    m_always_active = 1;
+    m_thread_safe_update = 0;
 
     m_vely = -18.0f;
 }
@@ -282,6 +288,7 @@ cFGoldpiece::cFGoldpiece(cSprite_Manager* sprite_manager, ObjectDirection dir /*
 {
     m_type = TYPE_FALLING_GOLDPIECE;
     m_camera_range = 2000;
+    m_thread_safe_update = 0;
     m_gravity_max = 25.0f;
     m_can_be_on_ground = 1;
 
@@ -116,6 +116,8 @@ void cMoving_Platform::Init(void)
     m_can_be_on_ground = 0;
 
     m_camera_range = 3000;
+    // may carry objects out of sight
+    m_always_active = 1;
     m_can_be_ground = 1;
 
     m_move_type = MOVING_PLATFORM_TYPE_LINE;
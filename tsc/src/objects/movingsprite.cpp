@@ -33,6 +33,8 @@ namespace TSC {
 
 /* *** *** *** *** *** *** *** cMovingSprite *** *** *** *** *** *** *** *** *** *** */
 
+bool cMovingSprite::m_skip_free_steps = 1;
+
 cMovingSprite::cMovingSprite(cSprite_Manager* sprite_manager, std::string type_name /* = "sprite" */)
     : cSprite(sprite_manager, type_name)
 {
@@ -240,11 +242,28 @@ cObjectCollisionType* cMovingSprite::Col_Move_in_Steps(float move_x, float move_
 
     bool move_x_valid = 1;
     bool move_y_valid = 1;
+    // if the last steps touched an object
+    bool touching = 0;
 
     /* Checks in both directions simultaneously
      * if a collision occurs it saves the direction
     */
     while (move_x_valid || move_y_valid) {
+        // skip the steps which can not touch anything
+        if (!touching && m_skip_free_steps) {
+            const unsigned int free_steps = Get_Free_Move_Steps(sprite_list, step_size_x, step_size_y, final_pos_x, final_pos_y);
+
+            if (free_steps) {
+                m_pos_x += step_size_x * free_steps;
+                m_pos_y += step_size_y * free_steps;
+
+                // update collision rects
+                Update_Position_Rect();
+            }
+        }
+
+        touching = 0;
+
         if (move_x_valid) {
             // nothing to do
             if (Is_Float_Equal(step_size_x, 0.0f)) {
@@ -297,6 +316,7 @@ cObjectCollisionType* cMovingSprite::Col_Move_in_Steps(float move_x, float move_
             }
 
             if (col_list_temp->size()) {
+                touching = 1;
                 col_list->objects.insert(col_list->objects.end(), col_list_temp->objects.begin(), col_list_temp->objects.end());
                 col_list_temp->objects.clear();
             }
@@ -374,6 +394,7 @@ cObjectCollisionType* cMovingSprite::Col_Move_in_Steps(float move_x, float move_
             }
 
             if (col_list_temp->size()) {
+                touching = 1;
                 col_list->objects.insert(col_list->objects.end(), col_list_temp->objects.begin(), col_list_temp->objects.end());
                 col_list_temp->objects.clear();
             }
@@ -403,6 +424,83 @@ cObjectCollisionType* cMovingSprite::Col_Move_in_Steps(float move_x, float move_
     return col_list;
 }
 
+/* Returns the steps needed on one axis until the rects touch
+ * returns 0 if they already overlap and -1 if they never touch
+*/
+static float Col_Axis_Steps(const float pos, const float size, const float obj_pos, const float obj_size, const float step_size)
+{
+    // object is after
+    if (obj_pos > pos + size) {
+        if (step_size <= 0.0f) {
+            return -1.0f;
+        }
+
+        return (obj_pos - (pos + size)) / step_size;
+    }
+    // object is before
+    if (obj_pos + obj_size < pos) {
+        if (step_size >= 0.0f) {
+            return -1.0f;
+        }
+
+        return (pos - (obj_pos + obj_size)) / -step_size;
+    }
+
+    return 0.0f;
+}
+
+unsigned int cMovingSprite::Get_Free_Move_Steps(const cSprite_List& sprite_list, float step_size_x, float step_size_y, float final_pos_x, float final_pos_y) const
+{
+    // last step is always checked as it gets clamped to the final position
+    float free_steps = -1.0f;
+
+    if (!Is_Float_Equal(step_size_x, 0.0f)) {
+        free_steps = floor((final_pos_x - m_pos_x) / step_size_x) - 1.0f;
+    }
+    if (!Is_Float_Equal(step_size_y, 0.0f)) {
+        float steps_y = floor((final_pos_y - m_pos_y) / step_size_y) - 1.0f;
+
+        if (free_steps < 0.0f || steps_y < free_steps) {
+            free_steps = steps_y;
+        }
+    }
+
+    if (free_steps < 1.0f) {
+        return 0;
+    }
+
+    for (cSprite_List::const_iterator itr = sprite_list.begin(); itr != sprite_list.end(); ++itr) {
+        const GL_rect& obj_rect = (*itr)->m_col_rect;
+
+        const float steps_x = Col_Axis_Steps(m_col_rect.m_x, m_col_rect.m_w, obj_rect.m_x, obj_rect.m_w, step_size_x);
+
+        if (steps_x < 0.0f) {
+            continue;
+        }
+
+        const float steps_y = Col_Axis_Steps(m_col_rect.m_y, m_col_rect.m_h, obj_rect.m_y, obj_rect.m_h, step_size_y);
+
+        if (steps_y < 0.0f) {
+            continue;
+        }
+
+        /* both axes need to touch
+         * the step reaching it and one more for rounding errors are not free
+        */
+        const float obj_steps = floor(std::max(steps_x, steps_y)) - 1.0f;
+
+        if (obj_steps < free_steps) {
+            free_steps = obj_steps;
+
+            if (free_steps < 1.0f) {
+                return 0;
+            }
+        }
+    }
+
+    return static_cast<unsigned int>(free_steps);
+}
+
 void cMovingSprite::Col_Move(float move_x, float move_y, bool real /* = 0 */, bool force /* = 0 */, bool check_on_ground /* = 1 */)
 {
     // no need to move
@@ -302,6 +302,11 @@ namespace TSC {
         // time counter if frozen
         float m_freeze_counter;
 
+        /* if set collision moves skip the steps which can not touch anything
+         * cleared by the movement tests to compare with plain stepping
+        */
+        static bool m_skip_free_steps;
+
     private:
         /* moves in steps and checks in both directions simultaneous
          * returns the found collisions
@@ -309,6 +314,11 @@ namespace TSC {
          * stop_on_internal : if set stops moving if internal collision was found
         */
         cObjectCollisionType* Col_Move_in_Steps(float move_x, float move_y, float step_size_x, float step_size_y, float final_pos_x, float final_pos_y, cSprite_List sprite_list, bool stop_on_internal = 0);
+        /* returns the number of following steps which can not touch any of the objects
+         * uses the swept collision rect of each axis to get the earliest possible contact
+         * steps reaching the final position are never skipped
+        */
+        unsigned int Get_Free_Move_Steps(const cSprite_List& sprite_list, float step_size_x, float step_size_y, float final_pos_x, float final_pos_y) const;
     };
 
     /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
@@ -68,6 +68,8 @@ void cSecret_Area::Init()
     m_massive_type = MASS_PASSIVE;
     m_editor_pos_z = 0.112f;
     m_camera_range = 1000;
+    // fades out the message window
+    m_always_active = 1;
 
     // size
     Set_Rect(GL_rect(m_rect.m_x, m_rect.m_y, 100, 100), true);
@@ -24,6 +24,8 @@
 #include "../video/gl_surface.hpp"
 #include "../video/renderer.hpp"
 #include "../core/sprite_manager.hpp"
+#include "../core/static_sprite_layer.hpp"
+#include "../core/activation_regions.hpp"
 #include "../core/editor/editor.hpp"
 #include "../core/i18n.hpp"
 #include "../scripting/events/touch_event.hpp"
@@ -346,6 +348,14 @@ cSprite::cSprite(XmlAttributes& attributes, cSprite_Manager* sprite_manager, con
 
 cSprite::~cSprite(void)
 {
+    if (m_static_layer) {
+        m_static_layer->Remove(this);
+    }
+
+    if (m_activation_regions) {
+        m_activation_regions->Remove(this);
+    }
+
     if (m_delete_image && m_image) {
         delete m_image;
         m_image = NULL;
@@ -436,6 +446,13 @@ void cSprite::Init(void)
     m_valid_update = 1;
 
     m_uid = -1;
+    m_static_layer = NULL;
+    m_sprite_manager_slot = -1;
+    m_activation_regions = NULL;
+    m_activation_region = NULL;
+    m_activation_slot = -1;
+    m_always_active = 0;
+    m_thread_safe_update = 0;
 }
 
 cSprite* cSprite::Copy(void) const
@@ -491,7 +508,7 @@ cSprite* cSprite::Copy(void) const
 xmlpp::Element* cSprite::Save_To_XML_Node(xmlpp::Element* p_element)
 {
 
-    xmlpp::Element* p_node = p_element->add_child_element(m_type_name);
+    xmlpp::Element* p_node = p_element->add_child_element(m_type_name.str());
 
 
     // position
@@ -650,6 +667,13 @@ void cSprite::Set_Image(cGL_Surface* new_image, bool new_start_image /* = 0 */,
 void cSprite::Set_Sprite_Type(SpriteType type)
 {
     m_type = type;
+    Update_Static_Layer();
+}
+
+size_t cSprite::Get_Memory_Size(void) const
+{
+    // shared image, type and tag strings are counted by the interned string pool
+    return sizeof(cSprite) + m_name.capacity() + m_collisions.capacity() * sizeof(cObjectCollision*);
 }
 
 /**
@@ -686,6 +710,25 @@ void cSprite::Set_Ignore_Camera(bool enable /* = 0 */)
     m_no_camera = enable;
 
     Update_Valid_Draw();
+    Update_Static_Layer();
+
+    if (m_activation_regions) {
+        m_activation_regions->Update_Sprite(this);
+    }
+}
+
+void cSprite::Set_Always_Active(bool enable /* = 0 */)
+{
+    // already set
+    if (m_always_active == enable) {
+        return;
+    }
+
+    m_always_active = enable;
+
+    if (m_activation_regions) {
+        m_activation_regions->Update_Sprite(this);
+    }
 }
 
 void cSprite::Set_Pos(float x, float y, bool new_startpos /* = 0 */)
@@ -734,6 +777,7 @@ void cSprite::Set_Active(bool enabled)
 
     Update_Valid_Draw();
     Update_Valid_Update();
+    Update_Static_Layer();
 }
 
 /** Set a Color Combination ( GL_ADD, GL_MODULATE or GL_REPLACE ).
@@ -753,6 +797,8 @@ void cSprite::Set_Color_Combine(const float red, const float green, const float
     m_combine_color[0] = Clamp(red, 0.000001f, 1.0f);
     m_combine_color[1] = Clamp(green, 0.000001f, 1.0f);
     m_combine_color[2] = Clamp(blue, 0.000001f, 1.0f);
+
+    Update_Static_Layer();
 }
 
 void cSprite::Update_Rect_Rotation_Z(void)
@@ -807,6 +853,8 @@ void cSprite::Set_Rotation_X(float rot, bool new_start_rot /* = 0 */)
     if (m_rotation_affects_rect) {
         Update_Rect_Rotation_X();
     }
+
+    Update_Static_Layer();
 }
 
 void cSprite::Set_Rotation_Y(float rot, bool new_start_rot /* = 0 */)
@@ -820,6 +868,8 @@ void cSprite::Set_Rotation_Y(float rot, bool new_start_rot /* = 0 */)
     if (m_rotation_affects_rect) {
         Update_Rect_Rotation_Y();
     }
+
+    Update_Static_Layer();
 }
 
 void cSprite::Set_Rotation_Z(float rot, bool new_start_rot /* = 0 */)
@@ -833,6 +883,8 @@ void cSprite::Set_Rotation_Z(float rot, bool new_start_rot /* = 0 */)
     if (m_rotation_affects_rect) {
         Update_Rect_Rotation_Z();
     }
+
+    Update_Static_Layer();
 }
 void cSprite::Set_Scale_X(const float scale, const bool new_startscale /* = 0 */)
 {
@@ -858,6 +910,8 @@ void cSprite::Set_Scale_X(const float scale, const bool new_startscale /* = 0 */
     if (new_startscale) {
         m_start_scale_x = m_scale_x;
     }
+
+    Update_Static_Layer();
 }
 
 void cSprite::Set_Scale_Y(const float scale, const bool new_startscale /* = 0 */)
@@ -884,6 +938,8 @@ void cSprite::Set_Scale_Y(const float scale, const bool new_startscale /* = 0 */
     if (new_startscale) {
         m_start_scale_y = m_scale_y;
     }
+
+    Update_Static_Layer();
 }
 void cSprite::Set_On_Top(const cSprite* sprite, bool optimize_hor_pos /* = 1 */)
 {
@@ -940,6 +996,20 @@ void cSprite::Update_Position_Rect(void)
     }
 
     Update_Valid_Draw();
+
+    // the chunk may have changed
+    Update_Static_Layer();
+    // the region may have changed
+    if (m_activation_regions) {
+        m_activation_regions->Update_Sprite(this);
+    }
+}
+
+void cSprite::Update_Static_Layer(void)
+{
+    if (m_static_layer) {
+        m_static_layer->Set_Dirty();
+    }
 }
 
 void cSprite::Update_Valid_Draw(void)
@@ -1060,11 +1130,13 @@ void cSprite::Draw_Image(cSurface_Request* request /* = NULL */) const
 void cSprite::Draw_Image_Normal(cSurface_Request* request /* = NULL */) const
 {
     // texture id
-    request->m_texture_id = m_image->m_image;
+    request->m_texture_id = m_image->Get_Texture();
 
     // size
     request->m_w = m_image->m_start_w;
     request->m_h = m_image->m_start_h;
+    request->m_content_w = m_image->m_content_w;
+    request->m_content_h = m_image->m_content_h;
 
     // rotation
     request->m_rot_x += m_rot_x + m_image->m_base_rot_x;
@@ -1152,11 +1224,13 @@ void cSprite::Draw_Image_Normal(cSurface_Request* request /* = NULL */) const
 void cSprite::Draw_Image_Editor(cSurface_Request* request /* = NULL */) const
 {
     // texture id
-    request->m_texture_id = m_start_image->m_image;
+    request->m_texture_id = m_start_image->Get_Texture();
 
     // size
     request->m_w = m_start_image->m_start_w;
     request->m_h = m_start_image->m_start_h;
+    request->m_content_w = m_start_image->m_content_w;
+    request->m_content_h = m_start_image->m_content_h;
 
     // rotation
     request->m_rot_x += m_start_rot_x + m_start_image->m_base_rot_x;
@@ -1283,6 +1357,8 @@ void cSprite::Set_Massive_Type(MassiveType type)
         m_can_be_ground = false;
     }
 
+    Update_Static_Layer();
+
     // make it the latest sprite
     m_sprite_manager->Move_To_Back(this);
 }
@@ -1412,6 +1488,11 @@ void cSprite::Destroy(void)
     m_valid_draw = 0;
     m_valid_update = 0;
     Set_Image(NULL, 1);
+
+    // can be replaced by the next added sprite
+    if (m_sprite_manager) {
+        m_sprite_manager->Release_Slot(this);
+    }
 }
 
 /**
@@ -22,6 +22,7 @@
 #include "../video/video.hpp"
 #include "../video/img_set.hpp"
 #include "../core/collision.hpp"
+#include "../core/interned_string.hpp"
 #include "../scripting/scriptable_object.hpp"
 #include "../scripting/scripting.hpp"
 #include "../scripting/objects/sprites/mrb_sprite.hpp"
@@ -155,6 +156,9 @@ namespace TSC {
             return ss.str();
         }
 
+        // Return the estimated memory used by this sprite without its images
+        size_t Get_Memory_Size(void) const;
+
         // Set the sprite type
         void Set_Sprite_Type(SpriteType type);
 
@@ -162,6 +166,11 @@ namespace TSC {
          * default : disabled
         */
         void Set_Ignore_Camera(bool enable = 0);
+        /* Set if updated and drawn even if the camera is far away
+         * needed if the update has an effect out of camera range
+         * default : disabled
+        */
+        void Set_Always_Active(bool enable = 0);
         /* set if spawned
          * if set it is not saved in the level/world file
         */
@@ -199,6 +208,7 @@ namespace TSC {
         inline void Set_Shadow_Pos(const float pos)
         {
             m_shadow_pos = pos;
+            Update_Static_Layer();
         };
         // Set the shadow color
         inline void Set_Shadow_Color(const Color& shadow)
@@ -212,10 +222,12 @@ namespace TSC {
             m_color.green = green;
             m_color.blue = blue;
             m_color.alpha = alpha;
+            Update_Static_Layer();
         };
         inline void Set_Color(const Color& col)
         {
             m_color = col;
+            Update_Static_Layer();
         };
 
         /// Set a Color Combination ( GL_ADD, GL_MODULATE or GL_REPLACE )
@@ -317,6 +329,7 @@ namespace TSC {
             m_scale_down = down;
             m_scale_left = left;
             m_scale_right = right;
+            Update_Static_Layer();
         };
         // Set the scale
         void Set_Scale_X(const float scale, const bool new_startscale = 0);
@@ -365,6 +378,8 @@ namespace TSC {
 
         // Update the position rect values
         void Update_Position_Rect(void);
+        // rebuild the static layer drawing this sprite before its next draw
+        void Update_Static_Layer(void);
         // default update, derived updates should not call this again if they also call Update_Animation()
         virtual void Update(void) { Update_Animation(); };
         /* late update
@@ -457,7 +472,7 @@ namespace TSC {
         /// editor and first image
         cGL_Surface* m_start_image;
         /// image filename
-        std::string m_image_filename;
+        cInterned_String m_image_filename;
 
         /// complete image rect
         GL_rect m_rect;
@@ -523,7 +538,7 @@ namespace TSC {
         /// sprite type
         SpriteType m_type;
         /// internal type name
-        const std::string m_type_name;
+        const cInterned_String m_type_name;
         /// sprite array type
         ArrayType m_sprite_array;
         /// massive collision type
@@ -533,7 +548,7 @@ namespace TSC {
         /// with the editor's object menu. See
         /// cEditor::load_special_items() function. In normal
         /// gameplay, this is empty.
-        std::string m_editor_tags;
+        cInterned_String m_editor_tags;
 
         /// true if not using the camera position
         bool m_no_camera;
@@ -571,6 +586,24 @@ namespace TSC {
         /// ID to uniquely identify this sprite (UIDS[idhere] uses this)
         int m_uid;
 
+        /// static layer drawing this sprite or NULL if drawn by itself
+        cStatic_Sprite_Layer* m_static_layer;
+        /// position in the objects array of the sprite manager or -1 if never added
+        int m_sprite_manager_slot;
+        /// regions of the sprite manager waking this sprite or NULL if not used
+        cActivation_Regions* m_activation_regions;
+        /// region of the current position
+        cActivation_Region* m_activation_region;
+        /// position in the active sprites of the regions or -1 if asleep
+        int m_activation_slot;
+        /// updated and drawn even if the camera is far away
+        bool m_always_active;
+        /** Update() only changes the sprite itself and can run on a worker thread
+         * shared changes have to go through cJob_System::Run_Synced()
+         * it may not use rand() as the sequence would depend on the thread timing
+        */
+        bool m_thread_safe_update;
+
         static const float m_pos_z_passive_start; ///< Start Z position for passive elements
         static const float m_pos_z_massive_start; ///< Start Z position for massive elements
         static const float m_pos_z_front_passive_start; ///< Start Z position for front passive elements
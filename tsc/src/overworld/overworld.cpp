@@ -559,6 +559,12 @@ bool cOverworld::Key_Down(const sf::Event& evt)
         pOverworld_Manager->m_debug_mode = !pOverworld_Manager->m_debug_mode;
         game_debug = pOverworld_Manager->m_debug_mode;
     }
+    else if (evt.key.code == sf::Keyboard::B && evt.key.control && pOverworld_Manager->m_debug_mode) {
+        // compare the layer line searches on all worlds
+        for (vector<cOverworld*>::iterator itr = pOverworld_Manager->objects.begin(); itr != pOverworld_Manager->objects.end(); ++itr) {
+            (*itr)->m_layer->Benchmark();
+        }
+    }
     else if (evt.key.code == sf::Keyboard::L && editor_world_enabled) {
         // toggle layer drawing
         pOverworld_Manager->m_draw_layer = !pOverworld_Manager->m_draw_layer;
@@ -772,6 +778,56 @@ void cOverworld::Update_Waypoint_text(void)
     gp_hud->Set_Waypoint_Name(waypoint->Get_Destination(), color);
 }
 
+void cOverworld::Preload_Waypoint_Levels(int waypoint_num)
+{
+    cWaypoint* waypoint = Get_Waypoint(waypoint_num);
+
+    if (!waypoint) {
+        return;
+    }
+
+    vector<std::string> levelnames;
+
+    // the level which can be entered right away
+    if (waypoint->m_waypoint_type == WAYPOINT_NORMAL) {
+        levelnames.push_back(waypoint->Get_Destination());
+    }
+
+    vector<cWaypoint*> neighbours;
+
+    if (waypoint->m_exits.size() > 0) {
+        for (vector<waypoint_exit>::const_iterator itr = waypoint->m_exits.begin(); itr != waypoint->m_exits.end(); ++itr) {
+            if (itr->locked) {
+                continue;
+            }
+
+            cLayer_Line_Point_Start* line = m_layer->Get_Line_Start_By_UID(itr->line_start_uid);
+
+            if (line) {
+                neighbours.push_back(line->Get_Opposite_Waypoint_for_UID(itr->line_start_uid));
+            }
+        }
+    }
+    // legacy lines starting at this waypoint
+    else {
+        for (vector<cLayer_Line_Point_Start*>::iterator itr = m_layer->objects.begin(); itr != m_layer->objects.end(); ++itr) {
+            if (static_cast<int>((*itr)->m_origin) == waypoint_num) {
+                neighbours.push_back((*itr)->Get_End_Waypoint());
+            }
+        }
+    }
+
+    for (vector<cWaypoint*>::iterator itr = neighbours.begin(); itr != neighbours.end(); ++itr) {
+        cWaypoint* neighbour = (*itr);
+
+        if (neighbour && neighbour != waypoint && neighbour->m_access && neighbour->m_waypoint_type == WAYPOINT_NORMAL) {
+            levelnames.push_back(neighbour->Get_Destination());
+        }
+    }
+
+    pLevel_Manager->Preload(levelnames);
+}
+
 bool cOverworld::Goto_Next_Level(std::string taken_exit)
 {
     // if not in overworld only go to the next level on overworld enter
@@ -160,6 +160,8 @@ namespace TSC {
         int Get_Last_Valid_Waypoint(void);
         // update the Waypoint text
         void Update_Waypoint_text(void);
+        // preload the levels of the given Waypoint and the Waypoints reachable from it
+        void Preload_Waypoint_Levels(int waypoint_num);
 
         // Use the line associated with the level exit name passed
         // and enable the next level on that line. If an empty
@@ -28,8 +28,13 @@
 
 namespace fs = boost::filesystem;
 
+using namespace std;
+
 namespace TSC {
 
+// size of a line grid cell
+static const float line_grid_cell_size = 64.0f;
+
 /* *** *** *** *** *** *** *** *** cLayer_Line_Point *** *** *** *** *** *** *** *** *** */
 
 cLayer_Line_Point::cLayer_Line_Point(cSprite_Manager* sprite_manager, cOverworld* overworld, SpriteType new_type)
@@ -320,6 +325,12 @@ cLine_collision::cLine_collision(void)
 cLayer::cLayer(cOverworld* origin)
 {
     m_overworld = origin;
+
+    m_line_grid_dirty = 1;
+    m_line_grid_x = 0.0f;
+    m_line_grid_y = 0.0f;
+    m_line_grid_cols = 0;
+    m_line_grid_rows = 0;
 }
 
 cLayer::~cLayer(void)
@@ -340,6 +351,7 @@ void cLayer::Add(cLayer_Line_Point_Start* line_point)
     }
 
     cObject_Manager<cLayer_Line_Point_Start>::Add(line_point);
+    m_line_grid_dirty = 1;
 
     // check if in sprite manager
     if (m_overworld->m_sprite_manager->Get_Array_Num(line_point) == -1) {
@@ -393,10 +405,23 @@ void cLayer::Save_To_File(const fs::path& path)
     debug_print("Wrote world layer file '%s'.\n", path_to_utf8(path).c_str());
 }
 
+bool cLayer::Delete(size_t array_num, bool delete_data /* = 1 */)
+{
+    m_line_grid_dirty = 1;
+    return cObject_Manager<cLayer_Line_Point_Start>::Delete(array_num, delete_data);
+}
+
+bool cLayer::Delete(cLayer_Line_Point_Start* obj, bool delete_data /* = 1 */)
+{
+    m_line_grid_dirty = 1;
+    return cObject_Manager<cLayer_Line_Point_Start>::Delete(obj, delete_data);
+}
+
 void cLayer::Delete_All(void)
 {
     // only clear array
     objects.clear();
+    m_line_grid_dirty = 1;
 }
 
 cLayer_Line_Point_Start* cLayer::Get_Line_Collision_Start(const GL_rect& line_rect)
@@ -442,16 +467,90 @@ cLine_collision cLayer::Get_Line_Collision_Direction(float x, float y, ObjectDir
 
 cLine_collision cLayer::Get_Nearest(float x, float y, ObjectDirection dir /* = DIR_HORIZONTAL */, unsigned int check_size /* = 15 */, int only_origin_id /* = -1 */) const
 {
-    for (LayerLineList::const_iterator itr = objects.begin(); itr != objects.end(); ++itr) {
-        // get pointer
-        cLayer_Line_Point_Start* layer_line = (*itr);
+    const bool debug_draw = pOverworld_Manager->m_debug_mode && pOverworld_Manager->m_draw_layer;
+
+    return Find_Nearest(x, y, dir, check_size, only_origin_id, debug_draw);
+}
+
+cLine_collision cLayer::Find_Nearest(float x, float y, ObjectDirection dir, unsigned int check_size, int only_origin_id, bool debug_draw) const
+{
+    // lines can be moved in the editor without us knowing
+    if (editor_world_enabled) {
+        m_line_grid_dirty = 1;
+
+        for (size_t i = 0; i < objects.size(); i++) {
+            cLayer_Line_Point_Start* layer_line = objects[i];
+
+            // line is not from waypoint
+            if (only_origin_id >= 0 && only_origin_id != static_cast<int>(layer_line->m_origin)) {
+                continue;
+            }
+
+            cLine_collision col = Find_Nearest_Line(layer_line, i, x, y, dir, check_size, debug_draw);
+
+            // found
+            if (col.m_line) {
+                return col;
+            }
+        }
+
+        // none found
+        return cLine_collision();
+    }
+
+    if (m_line_grid_dirty) {
+        Update_Line_Grid();
+    }
+
+    // the direction lines can not be longer than this
+    const float reach = static_cast<float>(check_size);
+    int col_start, col_end, row_start, row_end;
+
+    if (dir == DIR_HORIZONTAL) {
+        col_start = Get_Line_Grid_Col(x - reach);
+        col_end = Get_Line_Grid_Col(x + reach);
+        row_start = row_end = Get_Line_Grid_Row(y);
+    }
+    else { // vertical
+        col_start = col_end = Get_Line_Grid_Col(x);
+        row_start = Get_Line_Grid_Row(y - reach);
+        row_end = Get_Line_Grid_Row(y + reach);
+    }
+
+    // outside of all lines
+    if (col_end < 0 || row_end < 0 || col_start >= m_line_grid_cols || row_start >= m_line_grid_rows) {
+        return cLine_collision();
+    }
+
+    col_start = std::max(col_start, 0);
+    row_start = std::max(row_start, 0);
+    col_end = std::min(col_end, m_line_grid_cols - 1);
+    row_end = std::min(row_end, m_line_grid_rows - 1);
+
+    m_line_candidates.clear();
+
+    for (int row = row_start; row <= row_end; row++) {
+        for (int col = col_start; col <= col_end; col++) {
+            const vector<int>& cell = m_line_grid[(row * m_line_grid_cols) + col];
+            m_line_candidates.insert(m_line_candidates.end(), cell.begin(), cell.end());
+        }
+    }
+
+    /* check in array order as the first colliding line is returned
+     * and not the nearest one
+    */
+    std::sort(m_line_candidates.begin(), m_line_candidates.end());
+    m_line_candidates.erase(std::unique(m_line_candidates.begin(), m_line_candidates.end()), m_line_candidates.end());
+
+    for (vector<int>::const_iterator itr = m_line_candidates.begin(); itr != m_line_candidates.end(); ++itr) {
+        cLayer_Line_Point_Start* layer_line = objects[*itr];
 
         // line is not from waypoint
-        if (only_origin_id >= 0 && only_origin_id != layer_line->m_origin) {
+        if (only_origin_id >= 0 && only_origin_id != static_cast<int>(layer_line->m_origin)) {
             continue;
         }
 
-        cLine_collision col = Get_Nearest_Line(layer_line, x, y, dir, check_size);
+        cLine_collision col = Find_Nearest_Line(layer_line, *itr, x, y, dir, check_size, debug_draw);
 
         // found
         if (col.m_line) {
@@ -464,69 +563,237 @@ cLine_collision cLayer::Get_Nearest(float x, float y, ObjectDirection dir /* = D
 }
 
 cLine_collision cLayer::Get_Nearest_Line(cLayer_Line_Point_Start* map_layer_line, float x, float y, ObjectDirection dir /* = DIR_HORIZONTAL */, unsigned int check_size /* = 15  */) const
+{
+    const bool debug_draw = pOverworld_Manager->m_debug_mode && pOverworld_Manager->m_draw_layer;
+
+    return Find_Nearest_Line(map_layer_line, Get_Array_Num(map_layer_line), x, y, dir, check_size, debug_draw);
+}
+
+cLine_collision cLayer::Get_Nearest_Stepping(float x, float y, ObjectDirection dir /* = DIR_HORIZONTAL */, unsigned int check_size /* = 15 */, int only_origin_id /* = -1 */) const
+{
+    for (size_t i = 0; i < objects.size(); i++) {
+        cLayer_Line_Point_Start* layer_line = objects[i];
+
+        // line is not from waypoint
+        if (only_origin_id >= 0 && only_origin_id != static_cast<int>(layer_line->m_origin)) {
+            continue;
+        }
+
+        cLine_collision col = Find_Nearest_Line_Stepping(layer_line, i, x, y, dir, check_size, 0);
+
+        // found
+        if (col.m_line) {
+            return col;
+        }
+    }
+
+    // none found
+    return cLine_collision();
+}
+
+void cLayer::Benchmark(void) const
+{
+    if (objects.empty()) {
+        return;
+    }
+
+    // sample points around all lines
+    float min_x = objects[0]->Get_Line_Pos_X();
+    float min_y = objects[0]->Get_Line_Pos_Y();
+    float max_x = min_x;
+    float max_y = min_y;
+
+    for (LayerLineList::const_iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+        const GL_line line = (*itr)->Get_Line();
+
+        min_x = std::min(min_x, std::min(line.m_x1, line.m_x2));
+        min_y = std::min(min_y, std::min(line.m_y1, line.m_y2));
+        max_x = std::max(max_x, std::max(line.m_x1, line.m_x2));
+        max_y = std::max(max_y, std::max(line.m_y1, line.m_y2));
+    }
+
+    const float border = 40.0f;
+    const float step = 5.0f;
+    // check sizes used by the overworld player
+    const unsigned int check_sizes[] = {15, 80};
+
+    vector<cLine_collision> stepping_results;
+    vector<cLine_collision> indexed_results;
+
+    std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+
+    for (float y = min_y - border; y <= max_y + border; y += step) {
+        for (float x = min_x - border; x <= max_x + border; x += step) {
+            for (unsigned int i = 0; i < 2; i++) {
+                stepping_results.push_back(Get_Nearest_Stepping(x, y, DIR_HORIZONTAL, check_sizes[i]));
+                stepping_results.push_back(Get_Nearest_Stepping(x, y, DIR_VERTICAL, check_sizes[i]));
+            }
+        }
+    }
+
+    std::chrono::high_resolution_clock::time_point middle = std::chrono::high_resolution_clock::now();
+
+    for (float y = min_y - border; y <= max_y + border; y += step) {
+        for (float x = min_x - border; x <= max_x + border; x += step) {
+            for (unsigned int i = 0; i < 2; i++) {
+                indexed_results.push_back(Find_Nearest(x, y, DIR_HORIZONTAL, check_sizes[i], -1, 0));
+                indexed_results.push_back(Find_Nearest(x, y, DIR_VERTICAL, check_sizes[i], -1, 0));
+            }
+        }
+    }
+
+    std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+    unsigned int mismatches = 0;
+
+    for (size_t i = 0; i < stepping_results.size(); i++) {
+        if (stepping_results[i].m_line != indexed_results[i].m_line || stepping_results[i].m_line_number != indexed_results[i].m_line_number || stepping_results[i].m_difference != indexed_results[i].m_difference) {
+            mismatches++;
+        }
+    }
+
+    long long stepping_us = std::chrono::duration_cast<std::chrono::microseconds>(middle - start).count();
+    long long indexed_us = std::chrono::duration_cast<std::chrono::microseconds>(end - middle).count();
+
+    cout << "Layer benchmark of world '" << m_overworld->m_description->m_name << "': "
+         << objects.size() << " lines, " << stepping_results.size() << " searches, "
+         << "stepping " << stepping_us << " us, indexed " << indexed_us << " us, "
+         << mismatches << " mismatches" << endl;
+}
+
+bool cLayer::Check_Nearest_Step(cLayer_Line_Point_Start* map_layer_line, GL_line& map_line, int line_number, float x, float y, ObjectDirection dir, float csize, bool debug_draw, cLine_collision& col) const
 {
     GL_line line_1, line_2;
 
+    line_1.m_x1 = x;
+    line_1.m_y1 = y;
+    line_1.m_x2 = x;
+    line_1.m_y2 = y;
+    line_2 = line_1;
+
+    // set line size
+    if (dir == DIR_HORIZONTAL) {
+        line_1.m_x1 += csize;
+        line_2.m_x2 -= csize;
+    }
+    else { // vertical
+        line_1.m_y1 += csize;
+        line_2.m_y2 -= csize;
+    }
+
+    // debug drawing
+    if (debug_draw) {
+        // create request
+        cLine_Request* line_request = new cLine_Request();
+        pVideo->Draw_Line(line_1.m_x1 - pActive_Camera->m_x, line_1.m_y1 - pActive_Camera->m_y, line_1.m_x2 - pActive_Camera->m_x, line_1.m_y2 - pActive_Camera->m_y, map_layer_line->m_pos_z + 0.001f, &white, line_request);
+        line_request->m_line_width = 2;
+        line_request->m_render_count = 50;
+        // add request
+        pRenderer->Add(line_request);
+
+        // create request
+        line_request = new cLine_Request();
+        pVideo->Draw_Line(line_2.m_x1 - pActive_Camera->m_x, line_2.m_y1 - pActive_Camera->m_y, line_2.m_x2 - pActive_Camera->m_x, line_2.m_y2 - pActive_Camera->m_y, map_layer_line->m_pos_z + 0.001f, &black, line_request);
+        line_request->m_line_width = 2;
+        line_request->m_render_count = 50;
+        // add request
+        pRenderer->Add(line_request);
+    }
+
+    // check direction line 1
+    if (line_1.Intersects(&map_line)) {
+        col.m_line = map_layer_line;
+        col.m_line_number = line_number;
+        col.m_difference = csize;
+
+        // found
+        return 1;
+    }
+
+    // check direction line 2
+    if (line_2.Intersects(&map_line)) {
+        col.m_line = map_layer_line;
+        col.m_line_number = line_number;
+        col.m_difference = -csize;
+
+        // found
+        return 1;
+    }
+
+    return 0;
+}
+
+cLine_collision cLayer::Find_Nearest_Line(cLayer_Line_Point_Start* map_layer_line, int line_number, float x, float y, ObjectDirection dir, unsigned int check_size, bool debug_draw) const
+{
     // create map line
     GL_line map_line = map_layer_line->Get_Line();
 
-    // check into both directions from inside
-    for (float csize = 0; csize < check_size; csize++) {
-        line_1.m_x1 = x;
-        line_1.m_y1 = y;
-        line_1.m_x2 = x;
-        line_1.m_y2 = y;
-        line_2 = line_1;
-
-        // set line size
-        if (dir == DIR_HORIZONTAL) {
-            line_1.m_x1 += csize;
-            line_2.m_x2 -= csize;
+    // distance to the point where the map line crosses the direction lines
+    float distance;
+
+    if (dir == DIR_HORIZONTAL) {
+        // parallel lines never intersect
+        if (map_line.m_y1 == map_line.m_y2) {
+            return cLine_collision();
         }
-        else { // vertical
-            line_1.m_y1 += csize;
-            line_2.m_y2 -= csize;
+
+        const float pos = (y - map_line.m_y1) / (map_line.m_y2 - map_line.m_y1);
+
+        // does not cross
+        if (pos < -0.01f || pos > 1.01f) {
+            return cLine_collision();
+        }
+
+        distance = map_line.m_x1 + (pos * (map_line.m_x2 - map_line.m_x1)) - x;
+    }
+    else { // vertical
+        // parallel lines never intersect
+        if (map_line.m_x1 == map_line.m_x2) {
+            return cLine_collision();
         }
 
-        // debug drawing
-        if (pOverworld_Manager->m_debug_mode && pOverworld_Manager->m_draw_layer) {
-            // create request
-            cLine_Request* line_request = new cLine_Request();
-            pVideo->Draw_Line(line_1.m_x1 - pActive_Camera->m_x, line_1.m_y1 - pActive_Camera->m_y, line_1.m_x2 - pActive_Camera->m_x, line_1.m_y2 - pActive_Camera->m_y, map_layer_line->m_pos_z + 0.001f, &white, line_request);
-            line_request->m_line_width = 2;
-            line_request->m_render_count = 50;
-            // add request
-            pRenderer->Add(line_request);
-
-            // create request
-            line_request = new cLine_Request();
-            pVideo->Draw_Line(line_2.m_x1 - pActive_Camera->m_x, line_2.m_y1 - pActive_Camera->m_y, line_2.m_x2 - pActive_Camera->m_x, line_2.m_y2 - pActive_Camera->m_y, map_layer_line->m_pos_z + 0.001f, &black, line_request);
-            line_request->m_line_width = 2;
-            line_request->m_render_count = 50;
-            // add request
-            pRenderer->Add(line_request);
+        const float pos = (x - map_line.m_x1) / (map_line.m_x2 - map_line.m_x1);
+
+        // does not cross
+        if (pos < -0.01f || pos > 1.01f) {
+            return cLine_collision();
         }
 
-        // check direction line 1
-        if (line_1.Intersects(&map_line)) {
-            cLine_collision col = cLine_collision();
+        distance = map_line.m_y1 + (pos * (map_line.m_y2 - map_line.m_y1)) - y;
+    }
+
+    distance = fabs(distance);
+
+    /* the stepping search finds the line at the first size reaching the
+     * crossing point, only check the sizes around it with the same test
+     * to get exactly the same result including rounding
+    */
+    float csize = std::max(floor(distance) - 1.0f, 1.0f);
+    const float last_csize = std::min(ceil(distance) + 1.0f, static_cast<float>(check_size) - 1.0f);
 
-            col.m_line = map_layer_line;
-            col.m_line_number = Get_Array_Num(map_layer_line);
-            col.m_difference = csize;
+    cLine_collision col;
 
+    for (; csize <= last_csize; csize++) {
+        if (Check_Nearest_Step(map_layer_line, map_line, line_number, x, y, dir, csize, debug_draw, col)) {
             // found
             return col;
         }
+    }
 
-        // check direction line 2
-        if (line_2.Intersects(&map_line)) {
-            cLine_collision col = cLine_collision();
+    // not found
+    return cLine_collision();
+}
 
-            col.m_line = map_layer_line;
-            col.m_line_number = Get_Array_Num(map_layer_line);
-            col.m_difference = -csize;
+cLine_collision cLayer::Find_Nearest_Line_Stepping(cLayer_Line_Point_Start* map_layer_line, int line_number, float x, float y, ObjectDirection dir, unsigned int check_size, bool debug_draw) const
+{
+    // create map line
+    GL_line map_line = map_layer_line->Get_Line();
+
+    cLine_collision col;
 
+    // check into both directions from inside
+    for (float csize = 0; csize < check_size; csize++) {
+        if (Check_Nearest_Step(map_layer_line, map_line, line_number, x, y, dir, csize, debug_draw, col)) {
             // found
             return col;
         }
@@ -536,6 +803,70 @@ cLine_collision cLayer::Get_Nearest_Line(cLayer_Line_Point_Start* map_layer_line
     return cLine_collision();
 }
 
+void cLayer::Update_Line_Grid(void) const
+{
+    m_line_grid.clear();
+    m_line_grid_dirty = 0;
+    m_line_grid_cols = 0;
+    m_line_grid_rows = 0;
+
+    if (objects.empty()) {
+        return;
+    }
+
+    // get the area of all lines
+    vector<GL_line> lines;
+    lines.reserve(objects.size());
+
+    for (LayerLineList::const_iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+        lines.push_back((*itr)->Get_Line());
+    }
+
+    float min_x = lines[0].m_x1;
+    float min_y = lines[0].m_y1;
+    float max_x = min_x;
+    float max_y = min_y;
+
+    for (vector<GL_line>::const_iterator itr = lines.begin(); itr != lines.end(); ++itr) {
+        min_x = std::min(min_x, std::min(itr->m_x1, itr->m_x2));
+        min_y = std::min(min_y, std::min(itr->m_y1, itr->m_y2));
+        max_x = std::max(max_x, std::max(itr->m_x1, itr->m_x2));
+        max_y = std::max(max_y, std::max(itr->m_y1, itr->m_y2));
+    }
+
+    m_line_grid_x = min_x;
+    m_line_grid_y = min_y;
+    m_line_grid_cols = Get_Line_Grid_Col(max_x) + 1;
+    m_line_grid_rows = Get_Line_Grid_Row(max_y) + 1;
+    m_line_grid.resize(m_line_grid_cols * m_line_grid_rows);
+
+    // add every line to the cells of its bounding box
+    for (size_t i = 0; i < lines.size(); i++) {
+        const GL_line& line = lines[i];
+
+        const int col_start = Get_Line_Grid_Col(std::min(line.m_x1, line.m_x2));
+        const int col_end = Get_Line_Grid_Col(std::max(line.m_x1, line.m_x2));
+        const int row_start = Get_Line_Grid_Row(std::min(line.m_y1, line.m_y2));
+        const int row_end = Get_Line_Grid_Row(std::max(line.m_y1, line.m_y2));
+
+        for (int row = row_start; row <= row_end; row++) {
+            for (int col = col_start; col <= col_end; col++) {
+                m_line_grid[(row * m_line_grid_cols) + col].push_back(i);
+            }
+        }
+    }
+}
+
+int cLayer::Get_Line_Grid_Col(float x) const
+{
+    return static_cast<int>(floor((x - m_line_grid_x) / line_grid_cell_size));
+}
+
+int cLayer::Get_Line_Grid_Row(float y) const
+{
+    return static_cast<int>(floor((y - m_line_grid_y) / line_grid_cell_size));
+}
+
 /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
 
 } // namespace TSC
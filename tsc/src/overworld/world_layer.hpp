@@ -137,6 +137,10 @@ namespace TSC {
         // Save to file, raises xmlpp::exception on failure
         void Save_To_File(const boost::filesystem::path& filename);
 
+        // Delete the line from the given array number
+        virtual bool Delete(size_t array_num, bool delete_data = 1);
+        // Delete the given line
+        virtual bool Delete(cLayer_Line_Point_Start* obj, bool delete_data = 1);
         // Delete all objects
         virtual void Delete_All(void);
 
@@ -161,8 +165,55 @@ namespace TSC {
         // Return the collision data between the given line and position
         cLine_collision Get_Nearest_Line(cLayer_Line_Point_Start* map_layer_line, float x, float y, ObjectDirection dir = DIR_HORIZONTAL, unsigned int check_size = 15) const;
 
+        /* Same as Get_Nearest() but uses the old search which steps the
+         * check lines pixel by pixel over every layer line.
+         * Only kept as reference for Benchmark().
+        */
+        cLine_collision Get_Nearest_Stepping(float x, float y, ObjectDirection dir = DIR_HORIZONTAL, unsigned int check_size = 15, int only_origin_id = -1) const;
+
+        /* Compare Get_Nearest() with Get_Nearest_Stepping() on points
+         * around all layer lines and print the timings and the amount
+         * of differing results
+        */
+        void Benchmark(void) const;
+
         // parent overworld
         cOverworld* m_overworld;
+
+    private:
+        // Return the collision data between the nearest line and the given position using the line grid
+        cLine_collision Find_Nearest(float x, float y, ObjectDirection dir, unsigned int check_size, int only_origin_id, bool debug_draw) const;
+        /* Check the direction lines of the given size against the map line
+         * and set the collision data if one of them intersects
+        */
+        bool Check_Nearest_Step(cLayer_Line_Point_Start* map_layer_line, GL_line& map_line, int line_number, float x, float y, ObjectDirection dir, float csize, bool debug_draw, cLine_collision& col) const;
+        /* Return the collision data between the given line and position
+         * calculates the crossing point and only checks the steps around it
+        */
+        cLine_collision Find_Nearest_Line(cLayer_Line_Point_Start* map_layer_line, int line_number, float x, float y, ObjectDirection dir, unsigned int check_size, bool debug_draw) const;
+        // Return the collision data between the given line and position by checking every step
+        cLine_collision Find_Nearest_Line_Stepping(cLayer_Line_Point_Start* map_layer_line, int line_number, float x, float y, ObjectDirection dir, unsigned int check_size, bool debug_draw) const;
+
+        // Rebuild the line grid from the current lines
+        void Update_Line_Grid(void) const;
+        // Return the grid cell position for the given coordinate
+        int Get_Line_Grid_Col(float x) const;
+        int Get_Line_Grid_Row(float y) const;
+
+        /* Line grid
+         * every cell holds the array numbers of the lines crossing its area
+         * rebuilt if lines were added or removed or the editor was used
+        */
+        mutable vector<vector<int> > m_line_grid;
+        mutable bool m_line_grid_dirty;
+        // grid origin
+        mutable float m_line_grid_x;
+        mutable float m_line_grid_y;
+        // grid size in cells
+        mutable int m_line_grid_cols;
+        mutable int m_line_grid_rows;
+        // reused candidate list for a search
+        mutable vector<int> m_line_candidates;
     };
 
     /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
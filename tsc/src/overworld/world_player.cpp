@@ -586,6 +586,11 @@ bool cOverworld_Player::Set_Waypoint(int waypoint, bool new_startpos /* = 0 */)
     // Update Waypoint text
     m_overworld->Update_Waypoint_text();
 
+    // prepare the levels which may be entered next
+    if (!editor_world_enabled) {
+        m_overworld->Preload_Waypoint_Levels(waypoint);
+    }
+
     return 1;
 }
 
@@ -0,0 +1,134 @@
+/***************************************************************************
+ * event_table.cpp - Event IDs and registered event handlers
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "event_table.hpp"
+
+using namespace TSC;
+using namespace TSC::Scripting;
+using namespace std;
+
+// Names of the Builtin_Event values, in the same order.
+static const char* builtin_event_names[EVENT_BUILTIN_COUNT] = {
+    "generic",
+    "activate",
+    "die",
+    "downgrade",
+    "enter",
+    "exit",
+    "gold_100",
+    "jump",
+    "key_down",
+    "load",
+    "save_load",
+    "shoot",
+    "spit",
+    "touch"
+};
+
+// Registered event names, indexed by ID
+static vector<string>& Get_Event_Names()
+{
+    static vector<string> event_names(builtin_event_names, builtin_event_names + EVENT_BUILTIN_COUNT);
+    return event_names;
+}
+
+static unordered_map<string, Event_ID>& Get_Event_IDs()
+{
+    static unordered_map<string, Event_ID> event_ids;
+
+    if (event_ids.empty()) {
+        for (Event_ID i = 0; i < EVENT_BUILTIN_COUNT; i++)
+            event_ids[builtin_event_names[i]] = i;
+    }
+
+    return event_ids;
+}
+
+// All existing tables, one per mruby interpreter.
+// Allocated once as objects may be destroyed during static destruction.
+static vector<cEvent_Handler_Table*>& Get_Event_Handler_Tables()
+{
+    static vector<cEvent_Handler_Table*>* tables = new vector<cEvent_Handler_Table*>();
+    return *tables;
+}
+
+/**
+ * Returns the ID for the given event name. Names not seen before
+ * get the next free ID, so an event bound from a script without
+ * a matching cEvent class simply never fires.
+ */
+Event_ID TSC::Scripting::Get_Event_ID(const std::string& evtname)
+{
+    unordered_map<string, Event_ID>& event_ids = Get_Event_IDs();
+
+    unordered_map<string, Event_ID>::iterator iter = event_ids.find(evtname);
+    if (iter != event_ids.end())
+        return iter->second;
+
+    Event_ID evtid = static_cast<Event_ID>(event_ids.size());
+    event_ids[evtname] = evtid;
+    Get_Event_Names().push_back(evtname);
+    return evtid;
+}
+
+const std::string& TSC::Scripting::Get_Event_Name(Event_ID evtid)
+{
+    static const std::string unknown = "unknown";
+    const vector<string>& event_names = Get_Event_Names();
+
+    if (evtid >= event_names.size())
+        return unknown;
+
+    return event_names[evtid];
+}
+
+cEvent_Handler_Table::cEvent_Handler_Table()
+{
+    Get_Event_Handler_Tables().push_back(this);
+}
+
+cEvent_Handler_Table::~cEvent_Handler_Table()
+{
+    vector<cEvent_Handler_Table*>& tables = Get_Event_Handler_Tables();
+    tables.erase(std::remove(tables.begin(), tables.end(), this), tables.end());
+}
+
+void cEvent_Handler_Table::Add(cScriptable_Object* p_obj, Event_ID evtid, mrb_value callback)
+{
+    m_handlers[cKey(p_obj, evtid)].push_back(callback);
+}
+
+void cEvent_Handler_Table::Remove(const cScriptable_Object* p_obj)
+{
+    HandlerMap::iterator iter = m_handlers.begin();
+    while (iter != m_handlers.end()) {
+        if (iter->first.mp_obj == p_obj)
+            iter = m_handlers.erase(iter);
+        else
+            ++iter;
+    }
+}
+
+void cEvent_Handler_Table::Clear()
+{
+    m_handlers.clear();
+}
+
+void cEvent_Handler_Table::Remove_From_All(const cScriptable_Object* p_obj)
+{
+    vector<cEvent_Handler_Table*>& tables = Get_Event_Handler_Tables();
+
+    for (vector<cEvent_Handler_Table*>::iterator iter = tables.begin(); iter != tables.end(); ++iter)
+        (*iter)->Remove(p_obj);
+}
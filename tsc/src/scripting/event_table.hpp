@@ -0,0 +1,114 @@
+/***************************************************************************
+ * event_table.hpp - Event IDs and registered event handlers
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TSC_SCRIPTING_EVENT_TABLE_HPP
+#define TSC_SCRIPTING_EVENT_TABLE_HPP
+#include "../core/global_basic.hpp"
+#include <unordered_map>
+
+namespace TSC {
+    namespace Scripting {
+
+        class cScriptable_Object;
+
+        typedef unsigned int Event_ID;
+
+        /**
+         * IDs of the events fired by the game. The names are registered
+         * in this order before any other name, see Get_Event_ID(). Event
+         * names only used from the scripts get the following IDs.
+         */
+        enum Builtin_Event {
+            EVENT_GENERIC = 0,
+            EVENT_ACTIVATE,
+            EVENT_DIE,
+            EVENT_DOWNGRADE,
+            EVENT_ENTER,
+            EVENT_EXIT,
+            EVENT_GOLD_100,
+            EVENT_JUMP,
+            EVENT_KEY_DOWN,
+            EVENT_LOAD,
+            EVENT_SAVE_LOAD,
+            EVENT_SHOOT,
+            EVENT_SPIT,
+            EVENT_TOUCH,
+            EVENT_BUILTIN_COUNT
+        };
+
+        // Returns the ID of the given event name, registering the name if it is new.
+        Event_ID Get_Event_ID(const std::string& evtname);
+        // Returns the name the event ID was registered with.
+        const std::string& Get_Event_Name(Event_ID evtid);
+
+        /**
+         * The event handlers registered in one mruby interpreter, keyed
+         * by object and event. Each level owns one of these with its
+         * interpreter, so handlers of a suspended main level are never
+         * run from a sublevel and all of them go away with the level.
+         * Objects without handlers have no entry at all.
+         */
+        class cEvent_Handler_Table {
+        public:
+            cEvent_Handler_Table();
+            ~cEvent_Handler_Table();
+
+            // Add a handler for the event of the object.
+            void Add(cScriptable_Object* p_obj, Event_ID evtid, mrb_value callback);
+            // Returns the handlers for the event of the object or NULL if there are none.
+            inline const std::vector<mrb_value>* Find(const cScriptable_Object* p_obj, Event_ID evtid) const
+            {
+                if (m_handlers.empty())
+                    return NULL;
+
+                HandlerMap::const_iterator iter = m_handlers.find(cKey(p_obj, evtid));
+                if (iter == m_handlers.end())
+                    return NULL;
+
+                return &iter->second;
+            }
+            // Remove all handlers of the object.
+            void Remove(const cScriptable_Object* p_obj);
+            // Remove all handlers.
+            void Clear();
+
+            // Remove the handlers of the object from all existing tables.
+            static void Remove_From_All(const cScriptable_Object* p_obj);
+        private:
+            struct cKey {
+                cKey(const cScriptable_Object* p_obj, Event_ID evtid)
+                    : mp_obj(p_obj), m_evtid(evtid) {}
+
+                bool operator==(const cKey& other) const
+                {
+                    return mp_obj == other.mp_obj && m_evtid == other.m_evtid;
+                }
+
+                const cScriptable_Object* mp_obj;
+                Event_ID m_evtid;
+            };
+
+            struct cKey_Hash {
+                size_t operator()(const cKey& key) const
+                {
+                    return std::hash<const void*>()(key.mp_obj) ^ (static_cast<size_t>(key.m_evtid) * 0x9e3779b9u);
+                }
+            };
+
+            typedef std::unordered_map<cKey, std::vector<mrb_value>, cKey_Hash> HandlerMap;
+            HandlerMap m_handlers;
+        };
+    };
+};
+#endif
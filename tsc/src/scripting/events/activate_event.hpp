@@ -21,10 +21,18 @@ namespace TSC {
     namespace Scripting {
         class cActivate_Event: public cEvent {
         public:
+            virtual cEvent* Copy(void) const
+            {
+                return new cActivate_Event(*this);
+            }
             virtual std::string Event_Name()
             {
                 return "activate";
             }
+            virtual Event_ID Event_Id()
+            {
+                return EVENT_ACTIVATE;
+            }
         };
     }
 }
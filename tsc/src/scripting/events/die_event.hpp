@@ -22,10 +22,18 @@ namespace TSC {
 
         class cDie_Event: public cEvent {
         public:
+            virtual cEvent* Copy(void) const
+            {
+                return new cDie_Event(*this);
+            }
             virtual std::string Event_Name()
             {
                 return "die";
             }
+            virtual Event_ID Event_Id()
+            {
+                return EVENT_DIE;
+            }
         };
     }
 }
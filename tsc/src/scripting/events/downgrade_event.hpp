@@ -22,7 +22,15 @@ namespace TSC {
         class cDowngrade_Event: public cEvent {
         public:
             cDowngrade_Event(int downgrades, int max_downgrades);
+            virtual cEvent* Copy(void) const
+            {
+                return new cDowngrade_Event(*this);
+            }
             virtual std::string Event_Name();
+            virtual Event_ID Event_Id()
+            {
+                return EVENT_DOWNGRADE;
+            }
             int Get_Downgrades();
             int Get_Max_Downgrades();
         protected:
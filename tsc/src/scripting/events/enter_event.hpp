@@ -23,10 +23,18 @@ namespace TSC {
 
         class cEnter_Event: public cEvent {
         public:
+            virtual cEvent* Copy(void) const
+            {
+                return new cEnter_Event(*this);
+            }
             virtual std::string Event_Name()
             {
                 return "enter";
             }
+            virtual Event_ID Event_Id()
+            {
+                return EVENT_ENTER;
+            }
         };
 
     }
@@ -15,6 +15,8 @@
 #include "event.hpp"
 #include "../../core/property_helper.hpp"
 #include "../../core/global_basic.hpp"
+#include "../../core/job_system.hpp"
+#include <memory>
 
 using namespace TSC;
 using namespace TSC::Scripting;
@@ -22,28 +24,46 @@ using namespace std;
 
 /**
  * Cycles through all registered event handlers for the event
- * name returned by the Event_Name() method and calls the
+ * ID returned by the Event_Id() method and calls the
  * Run_MRuby_Callback() method for each of them. See Run_MRuby_Callback()’s
  * documentation for more information on this.
  *
  * For subclasses, you don’t want to override Fire(), but rather
- * Run_MRuby_Callback() and Event_Name().
+ * Run_MRuby_Callback(), Event_Name() and Event_Id().
+ *
+ * If fired from a parallel sprite update, a copy of the event is
+ * fired after the update instead, as the handlers can change
+ * everything in the level.
  */
 void cEvent::Fire(cMRuby_Interpreter* p_mruby, Scripting::cScriptable_Object* p_obj)
 {
     // Menu level has no mruby interpreter
     if (!p_mruby)
         return;
-    mrb_state* p_state = p_mruby->Get_MRuby_State();
 
-    // Iterate through the list of callbacks and execute them
-    std::string evtname = Event_Name();
-    std::vector<mrb_value>::iterator start = p_obj->event_handlers_begin(evtname);
-    std::vector<mrb_value>::iterator end = p_obj->event_handlers_end(evtname);
+    if (cJob_System::Is_In_Job()) {
+        std::shared_ptr<cEvent> p_event(Copy());
+        cJob_System::Run_Synced([=]() {
+            p_event->Fire(p_mruby, p_obj);
+        });
+        return;
+    }
 
-    std::vector<mrb_value>::iterator iter;
-    for (iter=start; iter != end; iter++) {
-        Run_MRuby_Callback(p_mruby, *iter);
+    // Most objects have no handlers at all
+    const Event_ID evtid = Event_Id();
+    const std::vector<mrb_value>* p_handlers = p_mruby->Get_Event_Handlers().Find(p_obj, evtid);
+    if (!p_handlers)
+        return;
+
+    mrb_state* p_state = p_mruby->Get_MRuby_State();
+    cScript_Profiler& profiler = p_mruby->Get_Profiler();
+
+    // Iterate through the list of callbacks and execute them. A handler
+    // may bind further handlers, so don’t keep an iterator.
+    for (size_t i = 0; i < p_handlers->size(); i++) {
+        profiler.Begin(p_state, evtid, (*p_handlers)[i]);
+        Run_MRuby_Callback(p_mruby, (*p_handlers)[i]);
+        profiler.End();
         if (p_state->exc) {
             cerr << "Warning: Error running mruby handler:" << endl;
             mrb_print_error(p_state);
@@ -65,6 +85,17 @@ std::string cEvent::Event_Name()
     return "generic";
 }
 
+/**
+ * Returns the ID of the event name, used to look up the callbacks
+ * when Fire() is called. Subclasses should override this method
+ * to return the Builtin_Event value matching their Event_Name()
+ * so no string has to be built and looked up when firing.
+ */
+Event_ID cEvent::Event_Id()
+{
+    return Get_Event_ID(Event_Name());
+}
+
 /**
  * Called whenever a MRuby callback shall be run. The callback is
  * passed as a mruby lambda via the `callback' argument.
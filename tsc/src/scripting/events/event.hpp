@@ -16,6 +16,7 @@
 #define TSC_SCRIPTING_EVENT_HPP
 #include "../scripting.hpp"
 #include "../../scripting/scriptable_object.hpp"
+#include "../../scripting/event_table.hpp"
 
 // Defines an event handler function that forwards to the Eventable#bind
 // method, passing `evtname' as the first argument. Effectively implements
@@ -49,8 +50,12 @@ namespace TSC {
         // see for example level_save_event!
         class cEvent {
         public:
+            virtual ~cEvent() {}
+            // Return a copy for firing it later
+            virtual cEvent* Copy(void) const = 0;
             void Fire(cMRuby_Interpreter* p_mruby, Scripting::cScriptable_Object* p_obj);
             virtual std::string Event_Name();
+            virtual Event_ID Event_Id();
         protected:
             virtual void Run_MRuby_Callback(cMRuby_Interpreter* p_mruby, mrb_value callback);
         };
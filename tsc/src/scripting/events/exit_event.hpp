@@ -20,10 +20,18 @@ namespace TSC {
     namespace Scripting {
         class cExit_Event: public cEvent {
         public:
+            virtual cEvent* Copy(void) const
+            {
+                return new cExit_Event(*this);
+            }
             virtual std::string Event_Name()
             {
                 return "exit";
             }
+            virtual Event_ID Event_Id()
+            {
+                return EVENT_EXIT;
+            }
         };
     }
 }
@@ -22,10 +22,18 @@ namespace TSC {
 
         class cGold_100_Event: public cEvent {
         public:
+            virtual cEvent* Copy(void) const
+            {
+                return new cGold_100_Event(*this);
+            }
             virtual std::string Event_Name()
             {
                 return "gold_100";
             }
+            virtual Event_ID Event_Id()
+            {
+                return EVENT_GOLD_100;
+            }
         };
     }
 }
@@ -22,10 +22,18 @@ namespace TSC {
 
         class cJump_Event: public cEvent {
         public:
+            virtual cEvent* Copy(void) const
+            {
+                return new cJump_Event(*this);
+            }
             virtual std::string Event_Name()
             {
                 return "jump";
             }
+            virtual Event_ID Event_Id()
+            {
+                return EVENT_JUMP;
+            }
         };
     }
 }
@@ -22,7 +22,15 @@ namespace TSC {
         class cKeyDown_Event: public cEvent {
         public:
             cKeyDown_Event(std::string keyname);
+            virtual cEvent* Copy(void) const
+            {
+                return new cKeyDown_Event(*this);
+            }
             virtual std::string Event_Name();
+            virtual Event_ID Event_Id()
+            {
+                return EVENT_KEY_DOWN;
+            }
             std::string Get_Keyname();
         protected:
             virtual void Run_MRuby_Callback(cMRuby_Interpreter* p_mruby, mrb_value callback);
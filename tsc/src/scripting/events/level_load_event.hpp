@@ -22,7 +22,15 @@ namespace TSC {
         class cLevel_Load_Event: public cEvent {
         public:
             cLevel_Load_Event(std::string save_data);
+            virtual cEvent* Copy(void) const
+            {
+                return new cLevel_Load_Event(*this);
+            }
             virtual std::string Event_Name();
+            virtual Event_ID Event_Id()
+            {
+                return EVENT_LOAD;
+            }
             std::string Get_Save_Data();
         protected:
             virtual void Run_MRuby_Callback(cMRuby_Interpreter* p_mruby, mrb_value callback);
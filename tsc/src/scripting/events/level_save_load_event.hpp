@@ -23,7 +23,15 @@ namespace TSC {
         class cLevel_SaveLoad_Event: public cEvent {
         public:
             cLevel_SaveLoad_Event(bool is_save);
+            virtual cEvent* Copy(void) const
+            {
+                return new cLevel_SaveLoad_Event(*this);
+            }
             virtual std::string Event_Name();
+            virtual Event_ID Event_Id()
+            {
+                return EVENT_SAVE_LOAD;
+            }
             std::vector<Script_Data> Get_Storage();
             void Set_Storage(const std::vector<Script_Data>& storage);
         protected:
@@ -22,7 +22,15 @@ namespace TSC {
         class cShoot_Event: public cEvent {
         public:
             cShoot_Event(std::string ball_type);
+            virtual cEvent* Copy(void) const
+            {
+                return new cShoot_Event(*this);
+            }
             virtual std::string Event_Name();
+            virtual Event_ID Event_Id()
+            {
+                return EVENT_SHOOT;
+            }
             std::string Get_Ball_Type();
         protected:
             virtual void Run_MRuby_Callback(cMRuby_Interpreter* p_mruby, mrb_value callback);
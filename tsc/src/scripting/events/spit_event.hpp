@@ -21,10 +21,18 @@ namespace TSC {
     namespace Scripting {
         class cSpit_Event: public cEvent {
         public:
+            virtual cEvent* Copy(void) const
+            {
+                return new cSpit_Event(*this);
+            }
             virtual std::string Event_Name()
             {
                 return "spit";
             }
+            virtual Event_ID Event_Id()
+            {
+                return EVENT_SPIT;
+            }
         };
     }
 }
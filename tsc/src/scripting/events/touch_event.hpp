@@ -22,7 +22,15 @@ namespace TSC {
         class cTouch_Event: public cEvent {
         public:
             cTouch_Event(cSprite* p_collided);
+            virtual cEvent* Copy(void) const
+            {
+                return new cTouch_Event(*this);
+            }
             virtual std::string Event_Name();
+            virtual Event_ID Event_Id()
+            {
+                return EVENT_TOUCH;
+            }
             cSprite* Get_Collided();
         protected:
             virtual void Run_MRuby_Callback(cMRuby_Interpreter* p_mruby, mrb_value callback);
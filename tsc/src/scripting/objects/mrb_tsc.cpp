@@ -171,6 +171,46 @@ static mrb_value Is_Debug_Mode(mrb_state* p_state, mrb_value self)
 #endif
 }
 
+/**
+ * Method: TSC::profile_report
+ *
+ *   profile_report( [ limit ] ) → nil
+ *
+ * Print the time spent in the event handlers, timers and console
+ * code of this level to the game console. The C<limit> (default 20)
+ * most expensive callbacks are listed with the event, source location,
+ * number of calls, total, average and maximum time and the number of
+ * heap allocations.
+ */
+static mrb_value Profile_Report(mrb_state* p_state, mrb_value self)
+{
+    mrb_int limit = 20;
+    mrb_get_args(p_state, "|i", &limit);
+
+    if (limit < 0)
+        limit = 0;
+
+    Scripting::cMRuby_Interpreter* p_mruby = static_cast<Scripting::cMRuby_Interpreter*>(p_state->ud);
+    gp_game_console->Append_Text(p_mruby->Get_Profiler().Get_Report(static_cast<size_t>(limit)));
+
+    return mrb_nil_value();
+}
+
+/**
+ * Method: TSC::profile_reset
+ *
+ *   profile_reset() → nil
+ *
+ * Forget the measurements shown by C<profile_report>.
+ */
+static mrb_value Profile_Reset(mrb_state* p_state, mrb_value self)
+{
+    Scripting::cMRuby_Interpreter* p_mruby = static_cast<Scripting::cMRuby_Interpreter*>(p_state->ud);
+    p_mruby->Get_Profiler().Reset();
+
+    return mrb_nil_value();
+}
+
 /*
  * Internal method used to implement #puts et al.
  */
@@ -200,6 +240,8 @@ void TSC::Scripting::Init_TSC(mrb_state* p_state)
     mrb_define_module_function(p_state, p_rmTSC, "worst_framerate", Worst_Framerate, MRB_ARGS_NONE());
     mrb_define_module_function(p_state, p_rmTSC, "version", Version, MRB_ARGS_NONE());
     mrb_define_module_function(p_state, p_rmTSC, "debug_mode?", Is_Debug_Mode, MRB_ARGS_NONE());
+    mrb_define_module_function(p_state, p_rmTSC, "profile_report", Profile_Report, MRB_ARGS_OPT(1));
+    mrb_define_module_function(p_state, p_rmTSC, "profile_reset", Profile_Reset, MRB_ARGS_NONE());
 
     /* Cleanly remove the Kernel#__printstr__ method provided by the mruby-print MRBGEM
      * and instead overwrite it with our own. The mruby-print MRBGEM implements #puts et
@@ -723,6 +723,51 @@ static mrb_value Is_Active(mrb_state* p_state, mrb_value self)
     return mrb_bool_value(p_sprite->m_active);
 }
 
+/**
+ * Method: Sprite#always_active=
+ *
+ *   always_active=( bool ) → bool
+ *
+ * Sprites far away from the camera are normally neither updated nor
+ * drawn. Set this to C<true> to keep the sprite running everywhere in
+ * the level, e.g. if its events must fire while the player is
+ * somewhere else.
+ *
+ * =head4 Parameters
+ *
+ * =over
+ *
+ * =item [bool]
+ *
+ * C<true> to always update the sprite, C<false> to let it sleep while
+ * the camera is far away.
+ *
+ * =back
+ */
+static mrb_value Set_Always_Active(mrb_state* p_state, mrb_value self)
+{
+    mrb_bool status;
+    mrb_get_args(p_state, "b", &status);
+    cSprite* p_sprite = Get_Data_Ptr<cSprite>(p_state, self);
+    p_sprite->Set_Always_Active(status);
+
+    return mrb_bool_value(status);
+}
+
+/**
+ * Method: Sprite#always_active?
+ *
+ *   always_active?() → true or false
+ *
+ * Returns whether the sprite is updated even if the camera is far
+ * away. See L<#always_active=>.
+ */
+static mrb_value Is_Always_Active(mrb_state* p_state, mrb_value self)
+{
+    cSprite* p_sprite = Get_Data_Ptr<cSprite>(p_state, self);
+    return mrb_bool_value(p_sprite->m_always_active);
+}
+
 void TSC::Scripting::Init_Sprite(mrb_state* p_state)
 {
     struct RClass* p_rcSprite = mrb_define_class(p_state, "Sprite", p_state->object_class);
@@ -760,6 +805,8 @@ void TSC::Scripting::Init_Sprite(mrb_state* p_state)
     mrb_define_method(p_state, p_rcSprite, "image=", Set_Image, MRB_ARGS_REQ(1));
     mrb_define_method(p_state, p_rcSprite, "active=", Set_Active, MRB_ARGS_REQ(1));
     mrb_define_method(p_state, p_rcSprite, "active?", Is_Active, MRB_ARGS_NONE());
+    mrb_define_method(p_state, p_rcSprite, "always_active=", Set_Always_Active, MRB_ARGS_REQ(1));
+    mrb_define_method(p_state, p_rcSprite, "always_active?", Is_Always_Active, MRB_ARGS_NONE());
     mrb_define_method(p_state, p_rcSprite, "suppress_save=", Set_Suppress_Save, MRB_ARGS_REQ(1));
     mrb_define_method(p_state, p_rcSprite, "suppress_save", Get_Suppress_Save, MRB_ARGS_NONE());
 
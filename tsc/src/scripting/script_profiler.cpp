@@ -0,0 +1,204 @@
+/***************************************************************************
+ * script_profiler.cpp - Timing of mruby callbacks
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "script_profiler.hpp"
+#include "../core/property_helper.hpp"
+#include "../user/preferences.hpp"
+
+using namespace TSC;
+using namespace TSC::Scripting;
+using namespace std;
+
+// instructions between two time limit checks
+static const unsigned int time_limit_check_interval = 1024;
+
+static uint64_t Elapsed_Microseconds(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end)
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+}
+
+// "file:line" of the proc or a placeholder if it has no debug info
+static std::string Get_Callback_Location(mrb_state* p_state, mrb_value callback)
+{
+    if (mrb_nil_p(callback))
+        return "(console)";
+
+    // keep an exception of a previous callback for the caller
+    struct RObject* p_exc = p_state->exc;
+    p_state->exc = NULL;
+
+    int arena = mrb_gc_arena_save(p_state);
+    mrb_value location = mrb_funcall(p_state, callback, "source_location", 0);
+    std::string result = "(unknown)";
+
+    if (p_state->exc)
+        p_state->exc = NULL;
+    else if (mrb_array_p(location) && RARRAY_LEN(location) == 2) {
+        mrb_value file = mrb_ary_ref(p_state, location, 0);
+        mrb_value line = mrb_ary_ref(p_state, location, 1);
+
+        if (mrb_string_p(file) && mrb_fixnum_p(line))
+            result = std::string(RSTRING_PTR(file), RSTRING_LEN(file)) + ":" + int_to_string(mrb_fixnum(line));
+    }
+
+    mrb_gc_arena_restore(p_state, arena);
+    p_state->exc = p_exc;
+    return result;
+}
+
+cScript_Profiler::cScript_Profiler()
+    : m_frame_budget(pPreferences->m_script_frame_budget),
+      m_time_limit(pPreferences->m_script_time_limit),
+      m_allocations(0),
+      m_frame_time(0),
+      m_frame_overruns(0),
+      m_fetch_counter(0),
+      m_aborted(false)
+{
+    //
+}
+
+void cScript_Profiler::Begin(mrb_state* p_state, Event_ID category, mrb_value callback)
+{
+    const void* p_proc = mrb_nil_p(callback) ? NULL : mrb_ptr(callback);
+    EntryMap::iterator iter = m_entries.find(cKey(category, p_proc));
+
+    // first call of this callback
+    if (iter == m_entries.end()) {
+        cEntry entry;
+        entry.m_location = Get_Callback_Location(p_state, callback);
+        entry.m_calls = 0;
+        entry.m_total_time = 0;
+        entry.m_max_time = 0;
+        entry.m_allocations = 0;
+
+        iter = m_entries.insert(std::make_pair(cKey(category, p_proc), entry)).first;
+    }
+
+    cRunning running;
+    running.mp_entry = &iter->second;
+    running.m_start = Clock::now();
+    running.m_allocations = m_allocations;
+
+    // the time limit applies to the outermost callback
+    if (m_running.empty()) {
+        m_deadline = running.m_start + std::chrono::milliseconds(m_time_limit);
+        m_fetch_counter = 0;
+        m_aborted = false;
+    }
+
+    m_running.push_back(running);
+}
+
+void cScript_Profiler::End()
+{
+    if (m_running.empty())
+        return;
+
+    const cRunning& running = m_running.back();
+    const uint64_t time = Elapsed_Microseconds(running.m_start, Clock::now());
+    cEntry* p_entry = running.mp_entry;
+
+    p_entry->m_calls++;
+    p_entry->m_total_time += time;
+    p_entry->m_allocations += m_allocations - running.m_allocations;
+
+    if (time > p_entry->m_max_time)
+        p_entry->m_max_time = time;
+
+    m_running.pop_back();
+
+    // nested callbacks are part of the outer time
+    if (m_running.empty())
+        m_frame_time += time;
+}
+
+void cScript_Profiler::End_Frame()
+{
+    if (m_frame_budget && m_frame_time > m_frame_budget) {
+        m_frame_overruns++;
+
+        // at most one warning per second
+        Clock::time_point now = Clock::now();
+        if (now - m_last_warning >= std::chrono::seconds(1)) {
+            cerr << "Warning: Scripts took " << m_frame_time << " us this frame (budget " << m_frame_budget << " us). See TSC.profile_report." << endl;
+            m_last_warning = now;
+        }
+    }
+
+    m_frame_time = 0;
+}
+
+void cScript_Profiler::Check_Time_Limit(mrb_state* p_state)
+{
+    if (m_running.empty() || m_aborted || !m_time_limit)
+        return;
+
+    // reading the clock for every instruction would be too expensive
+    if (++m_fetch_counter < time_limit_check_interval)
+        return;
+
+    m_fetch_counter = 0;
+
+    if (Clock::now() < m_deadline)
+        return;
+
+    // only once, so ensure blocks can still run
+    m_aborted = true;
+    mrb_raisef(p_state, E_RUNTIME_ERROR, "Script callback aborted after running for more than %S ms", mrb_fixnum_value(m_time_limit));
+}
+
+std::string cScript_Profiler::Get_Report(size_t limit) const
+{
+    std::vector<std::pair<cKey, const cEntry*> > entries;
+    for (EntryMap::const_iterator iter = m_entries.begin(); iter != m_entries.end(); ++iter) {
+        if (iter->second.m_calls)
+            entries.push_back(std::make_pair(iter->first, &iter->second));
+    }
+
+    // most expensive first
+    std::sort(entries.begin(), entries.end(), [](const std::pair<cKey, const cEntry*>& a, const std::pair<cKey, const cEntry*>& b) {
+        return a.second->m_total_time > b.second->m_total_time;
+    });
+
+    std::stringstream report;
+    report << "Script profile: " << entries.size() << " callbacks, " << m_frame_overruns << " frames over the budget of " << m_frame_budget << " us" << endl;
+    report << "event / location: calls, total ms, average us, max us, allocations" << endl;
+
+    for (size_t i = 0; i < entries.size() && i < limit; i++) {
+        const cEntry* p_entry = entries[i].second;
+
+        report << Get_Event_Name(entries[i].first.m_category) << " " << p_entry->m_location << ": "
+               << p_entry->m_calls << ", "
+               << p_entry->m_total_time / 1000 << ", "
+               << (p_entry->m_calls ? p_entry->m_total_time / p_entry->m_calls : 0) << ", "
+               << p_entry->m_max_time << ", "
+               << p_entry->m_allocations << endl;
+    }
+
+    return report.str();
+}
+
+void cScript_Profiler::Reset()
+{
+    // keep the running callbacks valid
+    for (EntryMap::iterator iter = m_entries.begin(); iter != m_entries.end(); ++iter) {
+        iter->second.m_calls = 0;
+        iter->second.m_total_time = 0;
+        iter->second.m_max_time = 0;
+        iter->second.m_allocations = 0;
+    }
+
+    m_frame_overruns = 0;
+}
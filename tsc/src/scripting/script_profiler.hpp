@@ -0,0 +1,127 @@
+/***************************************************************************
+ * script_profiler.hpp - Timing of mruby callbacks
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TSC_SCRIPTING_SCRIPT_PROFILER_HPP
+#define TSC_SCRIPTING_SCRIPT_PROFILER_HPP
+#include "../core/global_basic.hpp"
+#include "event_table.hpp"
+#include <chrono>
+#include <unordered_map>
+
+namespace TSC {
+    namespace Scripting {
+
+        /**
+         * Measures the wall time and heap allocations of every callback
+         * run by an mruby interpreter, attributed to the event (or
+         * "timer" and "console") and to the callback proc with its
+         * source location.
+         *
+         * It also watches the time spent in scripts. Frames using more
+         * than the frame budget print a warning, and a single callback
+         * running longer than the time limit is aborted with an exception
+         * raised from mruby's code fetch hook (if mruby was built with
+         * MRB_ENABLE_DEBUG_HOOK).
+         */
+        class cScript_Profiler {
+        public:
+            cScript_Profiler();
+
+            // Start timing a callback. Calls may nest.
+            void Begin(mrb_state* p_state, Event_ID category, mrb_value callback);
+            // Stop timing the callback started last.
+            void End();
+            // Check the frame budget and start the next frame. Call once per frame.
+            void End_Frame();
+
+            // Report of the most expensive callbacks, at most `limit' lines.
+            std::string Get_Report(size_t limit) const;
+            // Forget all measurements.
+            void Reset();
+
+            // Count a heap allocation of the interpreter.
+            inline void Count_Allocation()
+            {
+                m_allocations++;
+            }
+            // Abort the running callback if it exceeds the time limit.
+            // Called for every instruction from the code fetch hook.
+            void Check_Time_Limit(mrb_state* p_state);
+
+            // time scripts may use per frame before a warning in microseconds
+            unsigned int m_frame_budget;
+            // time a single callback may run before it is aborted in milliseconds, 0 to disable
+            unsigned int m_time_limit;
+        private:
+            typedef std::chrono::steady_clock Clock;
+
+            struct cKey {
+                cKey(Event_ID category, const void* p_proc)
+                    : m_category(category), mp_proc(p_proc) {}
+
+                bool operator==(const cKey& other) const
+                {
+                    return m_category == other.m_category && mp_proc == other.mp_proc;
+                }
+
+                Event_ID m_category;
+                const void* mp_proc;
+            };
+
+            struct cKey_Hash {
+                size_t operator()(const cKey& key) const
+                {
+                    return std::hash<const void*>()(key.mp_proc) ^ (static_cast<size_t>(key.m_category) * 0x9e3779b9u);
+                }
+            };
+
+            struct cEntry {
+                std::string m_location;
+                uint64_t m_calls;
+                uint64_t m_total_time;
+                uint64_t m_max_time;
+                uint64_t m_allocations;
+            };
+
+            struct cRunning {
+                cEntry* mp_entry;
+                Clock::time_point m_start;
+                uint64_t m_allocations;
+            };
+
+            typedef std::unordered_map<cKey, cEntry, cKey_Hash> EntryMap;
+
+            EntryMap m_entries;
+            // callbacks currently running, innermost last
+            std::vector<cRunning> m_running;
+            // heap allocations of the interpreter
+            uint64_t m_allocations;
+
+            // script time in the current frame in microseconds
+            uint64_t m_frame_time;
+            // frames over the budget since the last reset
+            uint64_t m_frame_overruns;
+            // time of the last budget warning
+            Clock::time_point m_last_warning;
+
+            // the outermost callback is aborted after this point
+            Clock::time_point m_deadline;
+            // instructions since the last time check
+            unsigned int m_fetch_counter;
+            // the running callback was aborted already
+            bool m_aborted;
+        };
+    };
+};
+#endif
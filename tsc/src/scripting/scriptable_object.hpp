@@ -22,25 +22,19 @@ namespace TSC {
         /**
          * This class encapsulates the stuff that is common
          * to all objects exposed to the mruby scripting
-         * interface. That is, it holds the mruby event tables.
+         * interface. The handlers themselves are kept in the
+         * cEvent_Handler_Table of the level's interpreter.
          */
         class cScriptable_Object {
         public:
             cScriptable_Object();
             virtual ~cScriptable_Object();
 
-            void clear_event_handlers(const std::string& levelname = "");
             void register_event_handler(const std::string& evtname, mrb_value callback);
-            std::vector<mrb_value>::iterator event_handlers_begin(const std::string& evtname);
-            std::vector<mrb_value>::iterator event_handlers_end(const std::string& evtname);
 
-        protected:
-            /// Mapping of level + event names and registered callbacks.
-            /// Example in ruby syntax:
-            /// {"mylevel" => {"myevent" => [handle1, handle2]}, "mevent2" => ["handle3"]}
-            std::map<std::string, std::map<std::string, std::vector<mrb_value> > > m_callbacks;
         private:
-            std::string get_active_level_name();
+            // set once a handler was registered, to skip the table cleanup for all others
+            bool m_has_event_handlers;
         };
     };
 };
@@ -19,6 +19,8 @@
 #include "../core/property_helper.hpp"
 #include "../core/filesystem/resource_manager.hpp"
 #include "../core/i18n.hpp"
+#include "../core/framerate.hpp"
+#include "../user/preferences.hpp"
 #include "../audio/audio.hpp"
 #include "../user/savegame/savegame.hpp"
 #include "../input/keyboard.hpp"
@@ -77,6 +79,11 @@
 #include "objects/specials/mrb_crate.hpp"
 #include "objects/specials/mrb_moving_platform.hpp"
 #include "../core/global_basic.hpp"
+#include <mruby/dump.h>
+#include <mruby/irep.h>
+#include <mruby/version.h>
+#include <mruby/gc.h>
+#include <chrono>
 
 ////////////////////////////////////////
 // Be sure to review docs/scripting.md!
@@ -91,11 +98,99 @@ namespace TSC {
 
 namespace Scripting {
 
+/* Header of a compiled script in the script cache. The file is only
+ * used if all of it matches, otherwise the code is compiled again. */
+struct Script_Cache_Header {
+    char magic[4];
+    uint32_t mruby_release;
+    uint64_t code_hash;
+    uint64_t code_size;
+};
+
+static const char script_cache_magic[4] = {'T', 'S', 'C', 'B'};
+
+// FNV-1a hash of the code and the context name used in the debug info
+static uint64_t Hash_Script_Code(const std::string& code, const std::string& contextname)
+{
+    uint64_t hash = 14695981039346656037ULL;
+
+    for (std::string::const_iterator iter = contextname.begin(); iter != contextname.end(); ++iter) {
+        hash ^= static_cast<unsigned char>(*iter);
+        hash *= 1099511628211ULL;
+    }
+
+    // separator
+    hash *= 1099511628211ULL;
+
+    for (std::string::const_iterator iter = code.begin(); iter != code.end(); ++iter) {
+        hash ^= static_cast<unsigned char>(*iter);
+        hash *= 1099511628211ULL;
+    }
+
+    return hash;
+}
+
+static void Fill_Script_Cache_Header(Script_Cache_Header& header, const std::string& code, uint64_t hash)
+{
+    memcpy(header.magic, script_cache_magic, sizeof(header.magic));
+    header.mruby_release = MRUBY_RELEASE_NO;
+    header.code_hash = hash;
+    header.code_size = code.size();
+}
+
+/* Returns true if the bytecode holds a complete mruby binary
+ * mrb_load_irep_cxt() takes no length and trusts the size written in the
+ * RITE header, so a truncated or corrupt file would be read past its end.
+*/
+static bool Is_Complete_Script_Bytecode(const std::string& bytecode)
+{
+    if (bytecode.size() < sizeof(struct rite_binary_header))
+        return false;
+
+    const struct rite_binary_header* p_header = reinterpret_cast<const struct rite_binary_header*>(bytecode.data());
+    return bin_to_uint32(p_header->binary_size) == bytecode.size();
+}
+
+// The cache file of the code, named by its hash
+static boost::filesystem::path Get_Script_Cache_Filename(uint64_t hash)
+{
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx.mrb", static_cast<unsigned long long>(hash));
+    return pResource_Manager->Get_User_Scriptcache_Directory() / utf8_to_path(name);
+}
+
+// Same as mruby's default allocator, counting allocations for the profiler
+static void* Script_Allocf(mrb_state* p_state, void* p, size_t size, void* ud)
+{
+    if (size == 0) {
+        free(p);
+        return NULL;
+    }
+
+    if (!p)
+        static_cast<cScript_Profiler*>(ud)->Count_Allocation();
+
+    return realloc(p, size);
+}
+
+#ifdef MRB_ENABLE_DEBUG_HOOK
+// Called before every instruction, aborts runaway callbacks
+static void Script_Code_Fetch_Hook(mrb_state* p_state, mrb_irep* p_irep, mrb_code* p_pc, mrb_value* p_regs)
+{
+    static_cast<cMRuby_Interpreter*>(p_state->ud)->Get_Profiler().Check_Time_Limit(p_state);
+}
+#endif
+
 cMRuby_Interpreter::cMRuby_Interpreter(cLevel* p_level)
 {
     // Set member variables
     mp_level = p_level;
-    mp_mruby = mrb_open();
+    mp_mruby = mrb_open_allocf(Script_Allocf, &m_profiler);
+    mp_mruby->ud = this;
+#ifdef MRB_ENABLE_DEBUG_HOOK
+    mp_mruby->code_fetch_hook = Script_Code_Fetch_Hook;
+#endif
+    m_gc_budget = pPreferences->m_script_gc_budget;
 
     // Create console context (execution context for the game console)
     mp_console_ctx = mrbc_context_new(mp_mruby);
@@ -103,6 +198,8 @@ cMRuby_Interpreter::cMRuby_Interpreter(cLevel* p_level)
     // TRANS: Prompt issued in the game console
     mrbc_filename(mp_mruby, mp_console_ctx, _("(console)"));
 
+    Set_GC_Generational(pPreferences->m_script_gc_generational);
+
     // Load TSC classes into mruby
     Load_Wrappers();
     // Load scripting library
@@ -113,19 +210,9 @@ cMRuby_Interpreter::~cMRuby_Interpreter()
 {
     /* When the mruby interpreter gets deleted, all remaining mruby objects
      * (mrb_value instances) are invalidated. Therefore, we wipe all the
-     * existing event callbacks here. */
-    std::string levelname = path_to_utf8(pActive_Level->m_level_filename.stem());
-    cSprite_List::iterator iter;
-    for (iter = mp_level->m_sprite_manager->objects.begin(); iter != mp_level->m_sprite_manager->objects.end(); iter++) {
-        cSprite* p_sprite = *iter;
-        p_sprite->clear_event_handlers(levelname); // Would probably work fine without the level name (→ total clearing) as these sprites do not live longer than the level itself anyway
-    }
-    // These objects stay alive even though a level ends. Only wipe those
-    // handlers for our own level.
-    pAudio->clear_event_handlers(levelname);
-    pKeyboard->clear_event_handlers(levelname);
-    pSavegame->clear_event_handlers(levelname);
-    pLevel_Player->clear_event_handlers(levelname);
+     * event callbacks registered in this interpreter here. Handlers of
+     * other levels, e.g. of the player, are kept in their own tables. */
+    m_event_handlers.Clear();
 
     // Get all the registered timers from mruby
     mrb_value klass = mrb_obj_value(mrb_class_get(mp_mruby, "Timer"));
@@ -157,6 +244,57 @@ mrb_state* cMRuby_Interpreter::Get_MRuby_State()
     return mp_mruby;
 }
 
+cEvent_Handler_Table& cMRuby_Interpreter::Get_Event_Handlers()
+{
+    return m_event_handlers;
+}
+
+void cMRuby_Interpreter::Set_GC_Generational(bool enable)
+{
+    // the GC module switches safely in the middle of a cycle
+    mrb_value gc_module = mrb_obj_value(mrb_module_get(mp_mruby, "GC"));
+    mrb_funcall(mp_mruby, gc_module, "generational_mode=", 1, mrb_bool_value(enable));
+
+    if (mp_mruby->exc) {
+        mrb_print_error(mp_mruby);
+        mp_mruby->exc = NULL;
+    }
+}
+
+void cMRuby_Interpreter::Update_GC()
+{
+    mrb_gc* p_gc = &mp_mruby->gc;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    uint32_t steps = 0;
+    uint32_t elapsed = 0;
+
+    /* Start a new cycle before the allocator would do it on its own
+     * (at the threshold) and continue a running cycle. The generational
+     * collector finishes a minor collection in one step. */
+    if (p_gc->state != MRB_GC_STATE_ROOT || p_gc->live >= p_gc->threshold / 4 * 3) {
+        do {
+            mrb_incremental_gc(mp_mruby);
+            steps++;
+
+            elapsed = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+        } while (p_gc->state != MRB_GC_STATE_ROOT && elapsed < m_gc_budget);
+    }
+
+    uint32_t pages = 0;
+    for (mrb_heap_page* p_page = p_gc->heaps; p_page; p_page = p_page->next)
+        pages++;
+
+    pFramerate->m_perf_script_gc_time = elapsed;
+    pFramerate->m_perf_script_gc_steps = steps;
+    pFramerate->m_perf_script_gc_live = static_cast<uint32_t>(p_gc->live);
+    pFramerate->m_perf_script_gc_pages = pages;
+}
+
+cScript_Profiler& cMRuby_Interpreter::Get_Profiler()
+{
+    return m_profiler;
+}
+
 const mrbc_context* cMRuby_Interpreter::Get_Console_Context() const
 {
     return mp_console_ctx;
@@ -177,7 +315,13 @@ mrb_value cMRuby_Interpreter::Run_Code_In_Context(const std::string& code, mrbc_
 
 mrb_value cMRuby_Interpreter::Run_Code_In_Console_Context(const std::string& code)
 {
-    return Run_Code_In_Context(code, mp_console_ctx);
+    static const Event_ID console_category = Get_Event_ID("console");
+
+    m_profiler.Begin(mp_mruby, console_category, mrb_nil_value());
+    mrb_value result = Run_Code_In_Context(code, mp_console_ctx);
+    m_profiler.End();
+
+    return result;
 }
 
 bool cMRuby_Interpreter::Run_Code(const std::string& code, const std::string& contextname)
@@ -190,7 +334,28 @@ bool cMRuby_Interpreter::Run_Code(const std::string& code, const std::string& co
     p_context->lineno = 1;
     mrbc_filename(mp_mruby, p_context, contextname.c_str()); // Set context filename (for exceptions)
 
-    Run_Code_In_Context(code, p_context);
+    /* Level scripts and the scripting library are run again on every
+     * level entry. Their compiled bytecode is kept in the script cache
+     * so only changed code has to be parsed. */
+    const uint64_t hash = Hash_Script_Code(code, contextname);
+    const boost::filesystem::path cachefile = Get_Script_Cache_Filename(hash);
+    std::string bytecode;
+
+    if (!Read_Script_Cache(cachefile, code, hash, bytecode)) {
+        debug_print("Scripting engine: compiling '%s'\n", contextname.c_str());
+
+        if (Compile_Code(code, p_context, bytecode))
+            Write_Script_Cache(cachefile, code, hash, bytecode);
+    }
+
+    if (!bytecode.empty())
+#if MRUBY_RELEASE_NO >= 30000
+        mrb_load_irep_buf_cxt(mp_mruby, bytecode.data(), bytecode.size(), p_context);
+#else
+        mrb_load_irep_cxt(mp_mruby, reinterpret_cast<const uint8_t*>(bytecode.data()), p_context);
+#endif
+    else if (!mp_mruby->exc) // could not be dumped
+        Run_Code_In_Context(code, p_context);
 
     bool result;
     if (mp_mruby->exc) {
@@ -208,6 +373,92 @@ bool cMRuby_Interpreter::Run_Code(const std::string& code, const std::string& co
     return result;
 }
 
+bool cMRuby_Interpreter::Compile_Code(const std::string& code, mrbc_context* p_context, std::string& bytecode)
+{
+    // keep the proc referenced while dumping
+    int arena = mrb_gc_arena_save(mp_mruby);
+
+    p_context->no_exec = TRUE;
+    mrb_value proc = mrb_load_nstring_cxt(mp_mruby, code.c_str(), code.length(), p_context);
+    p_context->no_exec = FALSE;
+
+    // syntax error
+    if (mp_mruby->exc || mrb_type(proc) != MRB_TT_PROC) {
+        mrb_gc_arena_restore(mp_mruby, arena);
+        return false;
+    }
+
+    uint8_t* p_bin = NULL;
+    size_t bin_size = 0;
+    int result = mrb_dump_irep(mp_mruby, mrb_proc_ptr(proc)->body.irep, DUMP_DEBUG_INFO, &p_bin, &bin_size);
+
+    if (result == MRB_DUMP_OK)
+        bytecode.assign(reinterpret_cast<const char*>(p_bin), bin_size);
+
+    if (p_bin)
+        mrb_free(mp_mruby, p_bin);
+
+    mrb_gc_arena_restore(mp_mruby, arena);
+    return result == MRB_DUMP_OK;
+}
+
+bool cMRuby_Interpreter::Read_Script_Cache(const boost::filesystem::path& cachefile, const std::string& code, uint64_t hash, std::string& bytecode)
+{
+    boost::filesystem::ifstream file(cachefile, ios::in | ios::binary);
+    if (!file.is_open())
+        return false;
+
+    Script_Cache_Header header;
+    Script_Cache_Header expected;
+    Fill_Script_Cache_Header(expected, code, hash);
+
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)))
+        return false;
+
+    // other mruby version or not from this code
+    if (memcmp(header.magic, expected.magic, sizeof(header.magic)) != 0 || header.mruby_release != expected.mruby_release || header.code_size != expected.code_size || header.code_hash != expected.code_hash) {
+        debug_print("Scripting engine: outdated script cache file '%s'\n", path_to_utf8(cachefile).c_str());
+        return false;
+    }
+
+    bytecode.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+
+    // truncated or corrupt
+    if (!Is_Complete_Script_Bytecode(bytecode)) {
+        debug_print("Scripting engine: damaged script cache file '%s'\n", path_to_utf8(cachefile).c_str());
+        bytecode.clear();
+        return false;
+    }
+
+    return true;
+}
+
+void cMRuby_Interpreter::Write_Script_Cache(const boost::filesystem::path& cachefile, const std::string& code, uint64_t hash, const std::string& bytecode)
+{
+    Script_Cache_Header header;
+    Fill_Script_Cache_Header(header, code, hash);
+
+    // write to a temporary file first so a crash never leaves a partial cache file
+    boost::filesystem::path tempfile = cachefile;
+    tempfile += utf8_to_path(".tmp");
+
+    boost::filesystem::ofstream file(tempfile, ios::out | ios::binary | ios::trunc);
+    if (!file.is_open()) {
+        cerr << "Warning: Could not write script cache file '" << path_to_utf8(tempfile) << "'" << endl;
+        return;
+    }
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(bytecode.data(), bytecode.size());
+    file.close();
+
+    boost::system::error_code error;
+    if (file.fail())
+        boost::filesystem::remove(tempfile, error);
+    else
+        boost::filesystem::rename(tempfile, cachefile, error);
+}
+
 bool cMRuby_Interpreter::Run_File(const boost::filesystem::path& filepath)
 {
     // Note we cannot use mrb_load_file(), because we use boost::filesystem’s
@@ -304,11 +555,15 @@ void cMRuby_Interpreter::Evaluate_Timer_Callbacks()
     if (m_callbacks.empty())
         return;
 
+    static const Event_ID timer_category = Get_Event_ID("timer");
+
     // Iterate through the list of registered callbacks
     // and evaluate each one
     std::vector<mrb_value>::iterator iter;
     for (iter = m_callbacks.begin(); iter != m_callbacks.end(); iter++) {
+        m_profiler.Begin(mp_mruby, timer_category, *iter);
         mrb_funcall(mp_mruby, *iter, "call", 0);
+        m_profiler.End();
         if (mp_mruby->exc) {
             // Exception occured
             gp_game_console->Display_Exception(mp_mruby);
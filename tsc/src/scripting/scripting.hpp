@@ -17,6 +17,8 @@
 #include "../core/global_basic.hpp"
 #include "../core/global_game.hpp"
 #include "objects/mrb_tsc.hpp"
+#include "event_table.hpp"
+#include "script_profiler.hpp"
 
 // Some defines to ease use of mruby
 #define MRB_ARGUMENT_ERROR(mrb) (mrb_class_get(mrb, "ArgumentError"))
@@ -99,12 +101,38 @@ namespace TSC {
             mrb_int Protect_From_GC(mrb_value obj);
             // Release the protection for an object created with Protect_From_GC().
             void Unprotect_From_GC(mrb_int index);
+            // Returns the event handlers registered in this interpreter.
+            cEvent_Handler_Table& Get_Event_Handlers();
+            // Returns the profiler timing the callbacks of this interpreter.
+            cScript_Profiler& Get_Profiler();
+            // Use the generational or the plain incremental garbage collector.
+            void Set_GC_Generational(bool enable);
+            /* Run incremental garbage collection steps within the budget
+             * Called once per frame so collection work is not done whenever
+             * some callback happens to allocate. Sets the script GC values
+             * of pFramerate.
+             */
+            void Update_GC();
         private:
             mrb_state* mp_mruby;
             mrbc_context* mp_console_ctx;
             cLevel* mp_level;
             std::vector<mrb_value> m_callbacks;
             boost::mutex m_callback_mutex;
+            cEvent_Handler_Table m_event_handlers;
+            cScript_Profiler m_profiler;
+            // time Update_GC() may spend per frame in microseconds
+            unsigned int m_gc_budget;
+
+            // Compile the code without running it and return the
+            // bytecode. Returns false on syntax errors (with the
+            // exception set) or if the code could not be dumped.
+            bool Compile_Code(const std::string& code, mrbc_context* p_context, std::string& bytecode);
+            // Read the bytecode of the code from the script cache.
+            // Returns false if not cached or cached by a different mruby version.
+            bool Read_Script_Cache(const boost::filesystem::path& cachefile, const std::string& code, uint64_t hash, std::string& bytecode);
+            // Store the bytecode of the code in the script cache.
+            void Write_Script_Cache(const boost::filesystem::path& cachefile, const std::string& code, uint64_t hash, const std::string& bytecode);
 
             // Load all MRuby wrapper classes for the C++ classes
             // into the given mruby state.
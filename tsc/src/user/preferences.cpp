@@ -50,6 +50,9 @@ const uint8_t cPreferences::m_video_screen_bpp_default = 32;
 */
 const bool cPreferences::m_video_vsync_default = 0;
 const uint16_t cPreferences::m_video_fps_limit_default = 240;
+// disable by default until it is known to work with all drivers
+const bool cPreferences::m_video_render_thread_default = 0;
+const uint32_t cPreferences::m_video_texture_budget_default = 512;
 // default geometry detail is medium
 const float cPreferences::m_geometry_quality_default = 0.5f;
 // default texture detail is high
@@ -151,6 +154,8 @@ void cPreferences::Save(void)
     Add_Property(p_root, "video_screen_bpp", static_cast<int>(m_video_screen_bpp));
     Add_Property(p_root, "video_vsync", m_video_vsync);
     Add_Property(p_root, "video_fps_limit", m_video_fps_limit);
+    Add_Property(p_root, "video_render_thread", m_video_render_thread);
+    Add_Property(p_root, "video_texture_budget", m_video_texture_budget);
     Add_Property(p_root, "video_geometry_quality", pVideo->m_geometry_quality);
     Add_Property(p_root, "video_texture_quality", pVideo->m_texture_quality);
     // Audio
@@ -194,6 +199,10 @@ void cPreferences::Save(void)
     // Special
     Add_Property(p_root, "level_background_images", m_level_background_images);
     Add_Property(p_root, "image_cache_enabled", m_image_cache_enabled);
+    Add_Property(p_root, "script_gc_generational", m_script_gc_generational);
+    Add_Property(p_root, "script_gc_budget", m_script_gc_budget);
+    Add_Property(p_root, "script_frame_budget", m_script_frame_budget);
+    Add_Property(p_root, "script_time_limit", m_script_time_limit);
     // Editor
     Add_Property(p_root, "editor_mouse_auto_hide", m_editor_mouse_auto_hide);
     Add_Property(p_root, "editor_show_item_images", m_editor_show_item_images);
@@ -218,6 +227,10 @@ void cPreferences::Reset_All(void)
     // Special
     m_level_background_images = 1;
     m_image_cache_enabled = 1;
+    m_script_gc_generational = 1;
+    m_script_gc_budget = 500;
+    m_script_frame_budget = 5000;
+    m_script_time_limit = 5000;
 }
 
 void cPreferences::Reset_Game(void)
@@ -237,6 +250,8 @@ void cPreferences::Reset_Video(void)
     m_video_screen_bpp = m_video_screen_bpp_default;
     m_video_vsync = m_video_vsync_default;
     m_video_fps_limit = m_video_fps_limit_default;
+    m_video_render_thread = m_video_render_thread_default;
+    m_video_texture_budget = m_video_texture_budget_default;
     m_video_fullscreen = m_video_fullscreen_default;
     pVideo->m_geometry_quality = m_geometry_quality_default;
     pVideo->m_texture_quality = m_texture_quality_default;
@@ -82,6 +82,10 @@ namespace TSC {
         uint8_t m_video_screen_bpp;
         bool m_video_vsync;
         uint16_t m_video_fps_limit;
+        // render in a thread while the next frame is updated
+        bool m_video_render_thread;
+        // texture memory in MiB before unused textures are evicted or 0 if unlimited
+        uint32_t m_video_texture_budget;
 
         // Keyboard
         // key definitions
@@ -134,6 +138,14 @@ namespace TSC {
         bool m_level_background_images;
         // image cache enabled
         bool m_image_cache_enabled;
+        // use the generational mruby garbage collector
+        bool m_script_gc_generational;
+        // microseconds of mruby garbage collection per level frame
+        unsigned int m_script_gc_budget;
+        // microseconds scripts may run per frame before a warning is printed
+        unsigned int m_script_frame_budget;
+        // milliseconds a script callback may run before it is aborted, 0 to disable
+        unsigned int m_script_time_limit;
 
         /* *** *** *** *** *** *** *** */
 
@@ -164,6 +176,8 @@ namespace TSC {
         static const uint8_t m_video_screen_bpp_default;
         static const bool m_video_vsync_default;
         static const uint16_t m_video_fps_limit_default;
+        static const bool m_video_render_thread_default;
+        static const uint32_t m_video_texture_budget_default;
         static const float m_geometry_quality_default;
         static const float m_texture_quality_default;
         // Keyboard
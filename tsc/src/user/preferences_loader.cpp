@@ -158,6 +158,10 @@ void cPreferencesLoader::handle_property(const std::string& name, const std::str
         mp_preferences->m_video_vsync = string_to_bool(value);
     else if (name == "video_fps_limit")
         mp_preferences->m_video_fps_limit = string_to_int(value);
+    else if (name == "video_render_thread")
+        mp_preferences->m_video_render_thread = string_to_bool(value);
+    else if (name == "video_texture_budget")
+        mp_preferences->m_video_texture_budget = string_to_uint(value);
     else if (name == "video_fullscreen")
         mp_preferences->m_video_fullscreen = string_to_bool(value);
     else if (name == "video_geometry_detail" || name == "video_geometry_quality")
@@ -332,6 +336,23 @@ void cPreferencesLoader::handle_property(const std::string& name, const std::str
         mp_preferences->m_level_background_images = string_to_bool(value);
     else if (name == "image_cache_enabled")
         mp_preferences->m_image_cache_enabled = string_to_bool(value);
+    else if (name == "script_gc_generational")
+        mp_preferences->m_script_gc_generational = string_to_bool(value);
+    else if (name == "script_gc_budget") {
+        val = string_to_int(value);
+        if (val >= 0 && val <= 100000)
+            mp_preferences->m_script_gc_budget = val;
+    }
+    else if (name == "script_frame_budget") {
+        val = string_to_int(value);
+        if (val >= 0 && val <= 1000000)
+            mp_preferences->m_script_frame_budget = val;
+    }
+    else if (name == "script_time_limit") {
+        val = string_to_int(value);
+        if (val >= 0 && val <= 600000)
+            mp_preferences->m_script_time_limit = val;
+    }
     //////////////////// Editor ////////////////////
     else if (name == "editor_mouse_auto_hide")
         mp_preferences->m_editor_mouse_auto_hide = string_to_bool(value);
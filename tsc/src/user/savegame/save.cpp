@@ -110,8 +110,25 @@ std::string cSave::Get_Active_Level(void)
 
 void cSave::Write_To_File(fs::path filepath)
 {
-    xmlpp::Document doc;
-    xmlpp::Element* p_root = doc.create_root_node("savegame");
+    xmlpp::Document* p_doc = Create_Document();
+
+    try {
+        // Write to file (raises xmlpp::exception on error)
+        p_doc->write_to_file_formatted(Glib::filename_from_utf8(path_to_utf8(filepath)));
+    }
+    catch (...) {
+        delete p_doc;
+        throw;
+    }
+
+    delete p_doc;
+    debug_print("Wrote savegame file '%s'.\n", path_to_utf8(filepath).c_str());
+}
+
+xmlpp::Document* cSave::Create_Document(void)
+{
+    xmlpp::Document* p_doc = new xmlpp::Document();
+    xmlpp::Element* p_root = p_doc->create_root_node("savegame");
     xmlpp::Element* p_node = NULL;
 
     // <information>
@@ -207,7 +224,5 @@ void cSave::Write_To_File(fs::path filepath)
         // </overworld>
     }
 
-    // Write to file (raises xmlpp::exception on error)
-    doc.write_to_file_formatted(Glib::filename_from_utf8(path_to_utf8(filepath)));
-    debug_print("Wrote savegame file '%s'.\n", path_to_utf8(filepath).c_str());
+    return p_doc;
 }
@@ -50,6 +50,12 @@ namespace TSC {
         // Write the savegame out to the given file; raises
         // xmlpp::exception on error.
         void Write_To_File(boost::filesystem::path filepath);
+        /* Create the savegame document
+         * Reads the current state of the saved level sprites and must
+         * therefore be called from the main thread. Writing the returned
+         * document is safe from any thread. It must be deleted by you.
+        */
+        xmlpp::Document* Create_Document(void);
 
         // savegame version
         int m_version;
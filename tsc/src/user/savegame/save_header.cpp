@@ -0,0 +1,241 @@
+/***************************************************************************
+ * save_header.cpp - Savegame summary shown in the load and save menus
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "save_header.hpp"
+#include "save.hpp"
+#include "../../core/math/utilities.hpp"
+#include "../../core/property_helper.hpp"
+#include "../../core/global_basic.hpp"
+
+using namespace std;
+
+namespace fs = boost::filesystem;
+
+namespace TSC {
+
+// first line of a header file
+static const std::string header_magic = "tsc-savegame-header " + int_to_string(SAVEGAME_HEADER_VERSION);
+
+// keep each value on a single line
+static std::string Escape_Header_Value(const std::string& str)
+{
+    std::string result;
+    result.reserve(str.length());
+
+    for (std::string::const_iterator itr = str.begin(); itr != str.end(); ++itr) {
+        if (*itr == '\\') {
+            result += "\\\\";
+        }
+        else if (*itr == '\n') {
+            result += "\\n";
+        }
+        else if (*itr == '\r') {
+            result += "\\r";
+        }
+        else {
+            result += *itr;
+        }
+    }
+
+    return result;
+}
+
+static std::string Unescape_Header_Value(const std::string& str)
+{
+    std::string result;
+    result.reserve(str.length());
+
+    for (std::string::const_iterator itr = str.begin(); itr != str.end(); ++itr) {
+        if (*itr != '\\' || itr + 1 == str.end()) {
+            result += *itr;
+            continue;
+        }
+
+        ++itr;
+
+        if (*itr == 'n') {
+            result += '\n';
+        }
+        else if (*itr == 'r') {
+            result += '\r';
+        }
+        else {
+            result += *itr;
+        }
+    }
+
+    return result;
+}
+
+/* *** *** *** *** *** *** *** cSave_Header *** *** *** *** *** *** *** *** *** *** */
+
+cSave_Header::cSave_Header(void)
+{
+    Init();
+}
+
+void cSave_Header::Init(void)
+{
+    m_savegame_size = 0;
+    m_savegame_write_time = 0;
+    m_version = 0;
+    m_save_time = 0;
+    m_description.clear();
+    m_overworld_active.clear();
+    m_active_level.clear();
+    m_levels.clear();
+}
+
+void cSave_Header::Set_Save(const cSave* save)
+{
+    m_version = save->m_version;
+    m_save_time = save->m_save_time;
+    m_description = save->m_description;
+    m_overworld_active = save->m_overworld_active;
+    m_active_level.clear();
+    m_levels.clear();
+
+    for (Save_LevelList::const_iterator itr = save->m_levels.begin(); itr != save->m_levels.end(); ++itr) {
+        const cSave_Level* level = (*itr);
+
+        m_levels.push_back(level->m_name);
+
+        // if active level
+        if (m_active_level.empty() && !Is_Float_Equal(level->m_level_pos_x, 0.0f) && !Is_Float_Equal(level->m_level_pos_y, 0.0f)) {
+            m_active_level = level->m_name;
+        }
+    }
+}
+
+void cSave_Header::Set_Savegame_File(const fs::path& savegame_file)
+{
+    boost::system::error_code error;
+
+    m_savegame_size = fs::file_size(savegame_file, error);
+    if (error) {
+        m_savegame_size = 0;
+    }
+
+    m_savegame_write_time = fs::last_write_time(savegame_file, error);
+    if (error) {
+        m_savegame_write_time = 0;
+    }
+}
+
+bool cSave_Header::Is_Current(const fs::path& savegame_file) const
+{
+    boost::system::error_code error;
+
+    const uintmax_t size = fs::file_size(savegame_file, error);
+    if (error || size != m_savegame_size) {
+        return 0;
+    }
+
+    const time_t write_time = fs::last_write_time(savegame_file, error);
+    if (error || write_time != m_savegame_write_time) {
+        return 0;
+    }
+
+    return 1;
+}
+
+bool cSave_Header::Load_From_File(const fs::path& filepath)
+{
+    Init();
+
+    fs::ifstream file(filepath, ios::in);
+    if (!file.is_open()) {
+        return 0;
+    }
+
+    std::string line;
+    if (!std::getline(file, line) || line != header_magic) {
+        return 0;
+    }
+
+    while (std::getline(file, line)) {
+        const std::string::size_type pos = line.find(' ');
+        const std::string key = line.substr(0, pos);
+        const std::string value = pos == std::string::npos ? "" : line.substr(pos + 1);
+
+        if (key == "savegame_size") {
+            m_savegame_size = string_to_int64(value);
+        }
+        else if (key == "savegame_write_time") {
+            m_savegame_write_time = static_cast<time_t>(string_to_int64(value));
+        }
+        else if (key == "version") {
+            m_version = string_to_int(value);
+        }
+        else if (key == "save_time") {
+            m_save_time = static_cast<time_t>(string_to_int64(value));
+        }
+        else if (key == "description") {
+            m_description = Unescape_Header_Value(value);
+        }
+        else if (key == "overworld_active") {
+            m_overworld_active = Unescape_Header_Value(value);
+        }
+        else if (key == "active_level") {
+            m_active_level = Unescape_Header_Value(value);
+        }
+        else if (key == "level") {
+            m_levels.push_back(Unescape_Header_Value(value));
+        }
+    }
+
+    return m_savegame_size > 0;
+}
+
+bool cSave_Header::Write_To_File(const fs::path& filepath) const
+{
+    // write to a temporary file first so a crash never leaves a partial header
+    fs::path tempfile = filepath;
+    tempfile += utf8_to_path(".tmp");
+
+    fs::ofstream file(tempfile, ios::out | ios::trunc);
+    if (!file.is_open()) {
+        cerr << "Warning: Could not write savegame header '" << path_to_utf8(tempfile) << "'" << endl;
+        return 0;
+    }
+
+    file << header_magic << "\n";
+    file << "savegame_size " << m_savegame_size << "\n";
+    file << "savegame_write_time " << static_cast<int64_t>(m_savegame_write_time) << "\n";
+    file << "version " << m_version << "\n";
+    file << "save_time " << static_cast<int64_t>(m_save_time) << "\n";
+    file << "description " << Escape_Header_Value(m_description) << "\n";
+    file << "overworld_active " << Escape_Header_Value(m_overworld_active) << "\n";
+    file << "active_level " << Escape_Header_Value(m_active_level) << "\n";
+
+    for (std::vector<std::string>::const_iterator itr = m_levels.begin(); itr != m_levels.end(); ++itr) {
+        file << "level " << Escape_Header_Value(*itr) << "\n";
+    }
+
+    file.close();
+
+    boost::system::error_code error;
+    if (file.fail()) {
+        fs::remove(tempfile, error);
+        return 0;
+    }
+
+    fs::rename(tempfile, filepath, error);
+    return !error;
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
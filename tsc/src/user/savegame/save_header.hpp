@@ -0,0 +1,72 @@
+/***************************************************************************
+ * save_header.hpp - Savegame summary shown in the load and save menus
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_SAVEGAME_SAVE_HEADER_HPP
+#define TSC_SAVEGAME_SAVE_HEADER_HPP
+#include "../../core/global_basic.hpp"
+
+namespace TSC {
+
+#define SAVEGAME_HEADER_VERSION 1
+
+    class cSave;
+
+    /* *** *** *** *** *** *** *** cSave_Header *** *** *** *** *** *** *** *** *** *** */
+    /* Summary of a savegame
+     * Written next to each savegame as a small text file so the menus don't
+     * have to parse the complete savegame with all its level object states.
+     * The size and modification time of the savegame file are stored to
+     * detect savegames changed without updating the header.
+    */
+    class cSave_Header {
+    public:
+        cSave_Header(void);
+
+        // Initialize data to empty values
+        void Init(void);
+
+        // Copy the summary from the savegame
+        void Set_Save(const cSave* save);
+        // Remember the size and modification time of the savegame file
+        void Set_Savegame_File(const boost::filesystem::path& savegame_file);
+        // Returns true if the savegame file was not changed since the header was created
+        bool Is_Current(const boost::filesystem::path& savegame_file) const;
+
+        // Read the header file, returns false if it is missing or invalid
+        bool Load_From_File(const boost::filesystem::path& filepath);
+        // Write the header file, returns false on failure
+        bool Write_To_File(const boost::filesystem::path& filepath) const;
+
+        // savegame file size
+        uintmax_t m_savegame_size;
+        // savegame file modification time
+        time_t m_savegame_write_time;
+
+        // savegame version
+        int m_version;
+        // time ( seconds since 1970 )
+        time_t m_save_time;
+        // description
+        std::string m_description;
+        // active overworld
+        std::string m_overworld_active;
+        // level the player is in or empty if unknown
+        std::string m_active_level;
+        // all saved levels
+        std::vector<std::string> m_levels;
+    };
+
+}
+#endif
@@ -284,7 +284,7 @@ int cSavegame::Load_Game(unsigned int save_slot)
     return save_type;
 }
 
-bool cSavegame::Save_Game(unsigned int save_slot, std::string description)
+bool cSavegame::Save_Game(unsigned int save_slot, std::string description, cSavegame_Writer::Callback callback /* = cSavegame_Writer::Callback() */)
 {
     if (pLevel_Player->m_alex_type == ALEX_DEAD || gp_hud->Get_Lives() < 0) {
         cerr << "Error : Couldn't save savegame " << description << " because of invalid game state" << endl;
@@ -423,28 +423,55 @@ bool cSavegame::Save_Game(unsigned int save_slot, std::string description)
 
     fs::path save_dir = pResource_Manager->Get_User_Savegame_Directory();
     fs::path filename = save_dir / utf8_to_path(int_to_string(save_slot) + ".tscsav");
-    // remove old format savegame files
-    fs::remove(save_dir / utf8_to_path(int_to_string(save_slot) + ".save"));
-    fs::remove(save_dir / utf8_to_path(int_to_string(save_slot) + ".smcsav"));
+    // old format savegame files are removed after writing
+    std::vector<fs::path> obsolete_files;
+    obsolete_files.push_back(save_dir / utf8_to_path(int_to_string(save_slot) + ".save"));
+    obsolete_files.push_back(save_dir / utf8_to_path(int_to_string(save_slot) + ".smcsav"));
 
-    try {
-        savegame->Write_To_File(filename);
-    }
-    catch (xmlpp::exception& e) {
-        cerr << "Failed to save savegame '" << filename << "': " << e.what() << endl
-             << "Is the file read-only?" << endl;
-        gp_hud->Set_Text(_("Couldn't save savegame ") + path_to_utf8(filename));
-    }
-
-    gp_hud->Set_Text(_("Saved to Slot ") + int_to_string(save_slot));
+    // summary for the menus
+    cSave_Header header;
+    header.Set_Save(savegame);
 
+    // the level state is read now, serializing and writing happens in the background
+    xmlpp::Document* p_doc = savegame->Create_Document();
     delete savegame;
 
+    // shown by the hud until the savegame is written
+    gp_hud->Set_Text(_("Saving..."));
+
+    m_writer.Write(save_slot, p_doc, filename, header, Get_Header_Filename(save_slot), obsolete_files, [filename, callback](unsigned int slot, bool success) {
+        if (success) {
+            gp_hud->Set_Text(_("Saved to Slot ") + int_to_string(slot));
+        }
+        else {
+            gp_hud->Set_Text(_("Couldn't save savegame ") + path_to_utf8(filename));
+        }
+
+        if (callback) {
+            callback(slot, success);
+        }
+    });
+
     return 1;
 }
 
+bool cSavegame::Is_Saving(void)
+{
+    return m_writer.Is_Busy();
+}
+
+void cSavegame::Update(void)
+{
+    m_writer.Update();
+}
+
 cSave* cSavegame::Load(unsigned int save_slot)
 {
+    // the slot may still be written
+    if (m_writer.Is_Busy(save_slot)) {
+        m_writer.Wait();
+    }
+
     fs::path save_dir = pResource_Manager->Get_User_Savegame_Directory();
     fs::path filename = save_dir / utf8_to_path(int_to_string(save_slot) + ".tscsav");
 
@@ -498,6 +525,11 @@ std::string cSavegame::Get_Description(unsigned int save_slot, bool only_descrip
 {
     std::string str_description;
 
+    // the slot may still be written
+    if (m_writer.Is_Busy(save_slot)) {
+        m_writer.Wait();
+    }
+
     if (!Is_Valid(save_slot)) {
         char str[255];
 
@@ -507,43 +539,91 @@ std::string cSavegame::Get_Description(unsigned int save_slot, bool only_descrip
     }
 
     // Raises exceptions if fails; caller must take care of them.
-    cSave* savegame = Load(save_slot);
+    cSave_Header header;
+    Get_Header(save_slot, header);
 
     // complete description
     if (!only_description) {
-        str_description = int_to_string(save_slot) + ". " + savegame->m_description;
+        str_description = int_to_string(save_slot) + ". " + header.m_description;
 
-        if (savegame->m_levels.empty()) {
-            str_description += " - " + savegame->m_overworld_active;
+        if (header.m_levels.empty()) {
+            str_description += " - " + header.m_overworld_active;
+        }
+        else if (!header.m_active_level.empty()) {
+            str_description += _(" -  Level ") + header.m_active_level;
         }
         else {
-            bool found_active = 0;
+            str_description += _(" -  Unknown");
+        }
 
-            for (Save_LevelList::iterator itr = savegame->m_levels.begin(); itr != savegame->m_levels.end(); ++itr) {
-                cSave_Level* level = (*itr);
+        str_description += _(" - Date ") + Time_to_String(header.m_save_time, "%Y-%m-%d  %H:%M:%S");
+    }
+    // only the user description
+    else {
+        str_description = header.m_description;
+    }
 
-                // if active level
-                if (!Is_Float_Equal(level->m_level_pos_x, 0.0f) && !Is_Float_Equal(level->m_level_pos_y, 0.0f)) {
-                    str_description += _(" -  Level ") + level->m_name;
-                    found_active = 1;
-                    break;
-                }
-            }
+    return str_description;
+}
 
-            if (!found_active) {
-                str_description += _(" -  Unknown");
+void cSavegame::Get_Header(unsigned int save_slot, cSave_Header& header)
+{
+    fs::path filename = Get_Savegame_Filename(save_slot);
+
+    if (!filename.empty() && header.Load_From_File(Get_Header_Filename(save_slot)) && header.Is_Current(filename)) {
+        // same check as Load()
+        for (std::vector<std::string>::const_iterator itr = header.m_levels.begin(); itr != header.m_levels.end(); ++itr) {
+            fs::path level_filename = pLevel_Manager->Get_Path(*itr);
+            if (level_filename.empty()) {
+                throw(InvalidLevelError("Empty level filename!"));
+            }
+            if (!File_Exists(level_filename)) {
+                std::string msg = "Level file not found: " + path_to_utf8(level_filename);
+                throw (InvalidLevelError(msg));
             }
         }
 
-        str_description += _(" - Date ") + Time_to_String(savegame->m_save_time, "%Y-%m-%d  %H:%M:%S");
-    }
-    // only the user description
-    else {
-        str_description = savegame->m_description;
+        return;
     }
 
+    // missing or outdated
+    cSave* savegame = Load(save_slot);
+    header.Set_Save(savegame);
     delete savegame;
-    return str_description;
+
+    if (!filename.empty()) {
+        header.Set_Savegame_File(filename);
+        header.Write_To_File(Get_Header_Filename(save_slot));
+    }
+}
+
+fs::path cSavegame::Get_Savegame_Filename(unsigned int save_slot) const
+{
+    fs::path save_dir = pResource_Manager->Get_User_Savegame_Directory();
+    fs::path filename = save_dir / utf8_to_path(int_to_string(save_slot) + ".tscsav");
+
+    if (File_Exists(filename)) {
+        return filename;
+    }
+
+    filename = save_dir / utf8_to_path(int_to_string(save_slot) + ".smcsav");
+
+    if (File_Exists(filename)) {
+        return filename;
+    }
+
+    filename = m_savegame_dir / utf8_to_path(int_to_string(save_slot) + ".save");
+
+    if (File_Exists(filename)) {
+        return filename;
+    }
+
+    return fs::path();
+}
+
+fs::path cSavegame::Get_Header_Filename(unsigned int save_slot) const
+{
+    return pResource_Manager->Get_User_Savegame_Directory() / utf8_to_path(int_to_string(save_slot) + ".tscsav_header");
 }
 
 bool cSavegame::Is_Valid(unsigned int save_slot) const
@@ -21,6 +21,8 @@
 #include "../../scripting/scriptable_object.hpp"
 #include "../../scripting/objects/misc/mrb_level.hpp"
 #include "save.hpp"
+#include "save_header.hpp"
+#include "savegame_writer.hpp"
 
 namespace TSC {
 
@@ -45,8 +47,15 @@ namespace TSC {
         * 2 if overworld save
         */
         int Load_Game(unsigned int save_slot);
-        // Save the game with the given description
-        bool Save_Game(unsigned int save_slot, std::string description);
+        /* Save the game with the given description
+         * The state is taken immediately but the file is written in the
+         * background. The callback is run from Update() when it is done.
+        */
+        bool Save_Game(unsigned int save_slot, std::string description, cSavegame_Writer::Callback callback = cSavegame_Writer::Callback());
+        // Returns true while a savegame is being written
+        bool Is_Saving(void);
+        // Handle finished savegame writes. Must be called from the main thread.
+        void Update(void);
 
         /**
          * \brief Load a Save
@@ -72,11 +81,26 @@ namespace TSC {
          */
         std::string Get_Description(unsigned int save_slot, bool only_description = 0);
 
+        /* Get the savegame summary
+         * Read from the header file written with the savegame. If it is
+         * missing or outdated the complete savegame is loaded once to
+         * create it. Raises the same exceptions as Load().
+        */
+        void Get_Header(unsigned int save_slot, cSave_Header& header);
+
         // Returns true if the Savegame is valid
         bool Is_Valid(unsigned int save_slot) const;
 
         // savegame directory
         boost::filesystem::path m_savegame_dir;
+    private:
+        // Return the existing savegame file or an empty path
+        boost::filesystem::path Get_Savegame_Filename(unsigned int save_slot) const;
+        // Return the header filename
+        boost::filesystem::path Get_Header_Filename(unsigned int save_slot) const;
+
+        // background savegame writing
+        cSavegame_Writer m_writer;
     };
 
     /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
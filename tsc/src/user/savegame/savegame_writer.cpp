@@ -0,0 +1,274 @@
+/***************************************************************************
+ * savegame_writer.cpp - Writes savegames on a worker thread
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "savegame_writer.hpp"
+#include "../../core/property_helper.hpp"
+#include "../../core/global_basic.hpp"
+#include <fcntl.h>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+namespace fs = boost::filesystem;
+
+namespace TSC {
+
+/* *** *** *** *** *** *** *** Disk syncing *** *** *** *** *** *** *** *** *** *** */
+
+// Write the data of the given file to the disk, returns false if failed
+static bool Sync_File(const fs::path& filename)
+{
+#ifdef _WIN32
+    int fd = _wopen(filename.wstring().c_str(), _O_RDWR | _O_BINARY);
+    if (fd < 0) {
+        return 0;
+    }
+
+    bool success = _commit(fd) == 0;
+    _close(fd);
+#else
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return 0;
+    }
+
+    bool success = fsync(fd) == 0;
+    close(fd);
+#endif
+    return success;
+}
+
+/* Write the entries of the given directory to the disk
+ * only possible on POSIX systems, Windows has no way to sync a directory
+*/
+static void Sync_Directory(const fs::path& dir)
+{
+#ifndef _WIN32
+    int fd = open(dir.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return;
+    }
+
+    fsync(fd);
+    close(fd);
+#endif
+}
+
+/* *** *** *** *** *** *** *** cSavegame_Writer *** *** *** *** *** *** *** *** *** *** */
+
+cSavegame_Writer::cSavegame_Writer(void)
+{
+    m_quit = 0;
+    m_active_job = NULL;
+
+    m_thread = boost::thread(&cSavegame_Writer::Worker, this);
+}
+
+cSavegame_Writer::~cSavegame_Writer(void)
+{
+    // never lose a savegame when exiting
+    Wait();
+
+    {
+        boost::lock_guard<boost::mutex> lock(m_mutex);
+        m_quit = 1;
+    }
+
+    m_condition.notify_one();
+
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+
+    // the callbacks may use objects already gone
+    for (list<cJob*>::iterator itr = m_finished.begin(); itr != m_finished.end(); ++itr) {
+        delete *itr;
+    }
+
+    m_finished.clear();
+}
+
+void cSavegame_Writer::Write(unsigned int save_slot, xmlpp::Document* p_doc, const fs::path& filename, const cSave_Header& header, const fs::path& header_filename, const vector<fs::path>& obsolete_files, Callback callback)
+{
+    cJob* job = new cJob();
+    job->m_save_slot = save_slot;
+    job->m_doc = p_doc;
+    job->m_filename = filename;
+    job->m_header = header;
+    job->m_header_filename = header_filename;
+    job->m_obsolete_files = obsolete_files;
+    job->m_callback = callback;
+    job->m_success = 0;
+
+    {
+        boost::lock_guard<boost::mutex> lock(m_mutex);
+        m_queue.push_back(job);
+    }
+
+    m_condition.notify_one();
+}
+
+bool cSavegame_Writer::Is_Busy(void)
+{
+    boost::lock_guard<boost::mutex> lock(m_mutex);
+    return m_active_job || !m_queue.empty();
+}
+
+bool cSavegame_Writer::Is_Busy(unsigned int save_slot)
+{
+    boost::lock_guard<boost::mutex> lock(m_mutex);
+
+    if (m_active_job && m_active_job->m_save_slot == save_slot) {
+        return 1;
+    }
+
+    for (list<cJob*>::const_iterator itr = m_queue.begin(); itr != m_queue.end(); ++itr) {
+        if ((*itr)->m_save_slot == save_slot) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+void cSavegame_Writer::Wait(void)
+{
+    boost::unique_lock<boost::mutex> lock(m_mutex);
+
+    while (m_active_job || !m_queue.empty()) {
+        m_finished_condition.wait(lock);
+    }
+}
+
+void cSavegame_Writer::Update(void)
+{
+    list<cJob*> finished;
+
+    {
+        boost::lock_guard<boost::mutex> lock(m_mutex);
+
+        if (m_finished.empty()) {
+            return;
+        }
+
+        finished.swap(m_finished);
+    }
+
+    for (list<cJob*>::iterator itr = finished.begin(); itr != finished.end(); ++itr) {
+        cJob* job = (*itr);
+
+        if (job->m_callback) {
+            job->m_callback(job->m_save_slot, job->m_success);
+        }
+
+        delete job;
+    }
+}
+
+void cSavegame_Writer::Worker(void)
+{
+    boost::unique_lock<boost::mutex> lock(m_mutex);
+
+    while (1) {
+        while (!m_quit && m_queue.empty()) {
+            m_condition.wait(lock);
+        }
+
+        if (m_quit) {
+            return;
+        }
+
+        m_active_job = m_queue.front();
+        m_queue.pop_front();
+
+        // write without blocking the main thread
+        lock.unlock();
+        bool success = Write_Job(m_active_job);
+        lock.lock();
+
+        m_active_job->m_success = success;
+        m_finished.push_back(m_active_job);
+        m_active_job = NULL;
+
+        m_finished_condition.notify_all();
+    }
+}
+
+bool cSavegame_Writer::Write_Job(cJob* job)
+{
+    fs::path tempfile = job->m_filename;
+    tempfile += utf8_to_path(".tmp");
+
+    bool success = 1;
+
+    try {
+        job->m_doc->write_to_file_formatted(Glib::filename_from_utf8(path_to_utf8(tempfile)));
+    }
+    catch (xmlpp::exception& e) {
+        cerr << "Failed to save savegame '" << path_to_utf8(job->m_filename) << "': " << e.what() << endl
+             << "Is the file read-only?" << endl;
+        success = 0;
+    }
+
+    delete job->m_doc;
+    job->m_doc = NULL;
+
+    boost::system::error_code error;
+
+    if (!success) {
+        fs::remove(tempfile, error);
+        return 0;
+    }
+
+    /* the data must be on the disk before the rename or a power loss
+     * could leave an empty file in the slot */
+    if (!Sync_File(tempfile)) {
+        cerr << "Failed to save savegame '" << path_to_utf8(job->m_filename) << "': Could not write it to the disk" << endl;
+        fs::remove(tempfile, error);
+        return 0;
+    }
+
+    // replace the old savegame only now that the new one is complete
+    fs::rename(tempfile, job->m_filename, error);
+
+    if (error) {
+        cerr << "Failed to save savegame '" << path_to_utf8(job->m_filename) << "': " << error.message() << endl;
+        fs::remove(tempfile, error);
+        return 0;
+    }
+
+    // keep the rename
+    Sync_Directory(job->m_filename.parent_path());
+
+    debug_print("Wrote savegame file '%s'.\n", path_to_utf8(job->m_filename).c_str());
+
+    // summary for the menus
+    job->m_header.Set_Savegame_File(job->m_filename);
+    job->m_header.Write_To_File(job->m_header_filename);
+
+    for (vector<fs::path>::const_iterator itr = job->m_obsolete_files.begin(); itr != job->m_obsolete_files.end(); ++itr) {
+        fs::remove(*itr, error);
+    }
+
+    return 1;
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
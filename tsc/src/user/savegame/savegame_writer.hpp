@@ -0,0 +1,88 @@
+/***************************************************************************
+ * savegame_writer.hpp - Writes savegames on a worker thread
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_SAVEGAME_WRITER_HPP
+#define TSC_SAVEGAME_WRITER_HPP
+#include "../../core/global_basic.hpp"
+#include "save_header.hpp"
+#include <list>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+
+namespace TSC {
+
+    /* *** *** *** *** *** *** *** cSavegame_Writer *** *** *** *** *** *** *** *** *** *** */
+    /* Serializes and writes savegame documents on a worker thread
+     * The document is created on the main thread and only written here.
+     * Each savegame is written to a temporary file first which replaces the
+     * slot file only when complete, so an interrupted write never leaves a
+     * broken savegame behind.
+    */
+    class cSavegame_Writer {
+    public:
+        // called on the main thread when a savegame was written or failed
+        typedef std::function<void(unsigned int save_slot, bool success)> Callback;
+
+        cSavegame_Writer(void);
+        ~cSavegame_Writer(void);
+
+        /* Queue the document for writing
+         * Takes ownership of the document. The header is written after the
+         * savegame succeeded. Obsolete files are removed afterwards.
+        */
+        void Write(unsigned int save_slot, xmlpp::Document* p_doc, const boost::filesystem::path& filename, const cSave_Header& header, const boost::filesystem::path& header_filename, const std::vector<boost::filesystem::path>& obsolete_files, Callback callback);
+        // Returns true if a savegame is queued or being written
+        bool Is_Busy(void);
+        // Returns true if the given slot is queued or being written
+        bool Is_Busy(unsigned int save_slot);
+        // Block until all queued savegames are written
+        void Wait(void);
+        // Run the callbacks of the finished savegames. Must be called from the main thread.
+        void Update(void);
+    private:
+        class cJob {
+        public:
+            unsigned int m_save_slot;
+            xmlpp::Document* m_doc;
+            boost::filesystem::path m_filename;
+            cSave_Header m_header;
+            boost::filesystem::path m_header_filename;
+            std::vector<boost::filesystem::path> m_obsolete_files;
+            Callback m_callback;
+            bool m_success;
+        };
+
+        // worker thread function
+        void Worker(void);
+        // write the job files, returns false on failure
+        bool Write_Job(cJob* job);
+
+        boost::thread m_thread;
+        boost::mutex m_mutex;
+        boost::condition_variable m_condition;
+        // signaled when a job finished
+        boost::condition_variable m_finished_condition;
+        bool m_quit;
+
+        // waiting jobs in saving order
+        std::list<cJob*> m_queue;
+        // job currently written by the worker or NULL
+        cJob* m_active_job;
+        // jobs waiting for their callback
+        std::list<cJob*> m_finished;
+    };
+
+}
+#endif
@@ -347,122 +347,98 @@ void cAnimation_Fireball::Draw(cSurface_Request* request /* = NULL */)
     }
 }
 
-/* *** *** *** *** *** *** *** cParticle *** *** *** *** *** *** *** *** *** *** */
-
-cParticle::cParticle(cParticle_Emitter* parent)
-    : cMovingSprite(parent->m_sprite_manager)
-{
-    m_can_be_on_ground = 0;
-    // scale centered
-    Set_Scale_Directions(1, 1, 1, 1);
-
-    m_time_to_live = 0.0f;
-    m_const_rot_x = 0.0f;
-    m_const_rot_y = 0.0f;
-    m_const_rot_z = 0.0f;
-    m_gravity_x = 0.0f;
-    m_gravity_y = 0.0f;
-
-    m_fade_pos = 1.0f;
-
-    m_parent = parent;
-}
-
-cParticle::~cParticle(void)
-{
-
-}
-
-void cParticle::Update(void)
-{
-    // update fade modifier
-    m_fade_pos -= ((static_cast<float>(speedfactor_fps) * 0.001f) * pFramerate->m_speed_factor) / m_time_to_live;
-
-    // finished fading
-    if (m_fade_pos <= 0.0f) {
-        m_fade_pos = 0.0f;
-        Set_Active(0);
-        return;
-    }
-
-    // with size fading
-    if (m_parent->m_fade_size) {
-        Set_Scale(m_start_scale_x * m_fade_pos);
-    }
-
-    // move
-    Move(m_velx, m_vely);
-    // todo : gravity maximum
-    Add_Velocity(m_gravity_x, m_gravity_y);
-
-    // constant rotation
-    if (!Is_Float_Equal(m_const_rot_x, 0.0f)) {
-        Add_Rotation_X(m_const_rot_x * pFramerate->m_speed_factor);
-    }
-    if (!Is_Float_Equal(m_const_rot_y, 0.0f)) {
-        Add_Rotation_Y(m_const_rot_y * pFramerate->m_speed_factor);
-    }
-    if (!Is_Float_Equal(m_const_rot_z, 0.0f)) {
-        Add_Rotation_Z(m_const_rot_z * pFramerate->m_speed_factor);
-    }
-}
-
-void cParticle::Draw(cSurface_Request* request /* = NULL */)
+/* *** *** *** *** *** *** *** cParticle_Pool *** *** *** *** *** *** *** *** *** *** */
+
+void cParticle_Pool::Clear(void)
+{
+    m_pos_x.clear();
+    m_pos_y.clear();
+    m_pos_z.clear();
+    m_vel_x.clear();
+    m_vel_y.clear();
+    m_gravity_x.clear();
+    m_gravity_y.clear();
+    m_rot_x.clear();
+    m_rot_y.clear();
+    m_rot_z.clear();
+    m_const_rot_x.clear();
+    m_const_rot_y.clear();
+    m_const_rot_z.clear();
+    m_start_scale.clear();
+    m_scale.clear();
+    m_time_to_live.clear();
+    m_fade_pos.clear();
+    m_color.clear();
+}
+
+size_t cParticle_Pool::Add(void)
+{
+    m_pos_x.push_back(0.0f);
+    m_pos_y.push_back(0.0f);
+    m_pos_z.push_back(0.0f);
+    m_vel_x.push_back(0.0f);
+    m_vel_y.push_back(0.0f);
+    m_gravity_x.push_back(0.0f);
+    m_gravity_y.push_back(0.0f);
+    m_rot_x.push_back(0.0f);
+    m_rot_y.push_back(0.0f);
+    m_rot_z.push_back(0.0f);
+    m_const_rot_x.push_back(0.0f);
+    m_const_rot_y.push_back(0.0f);
+    m_const_rot_z.push_back(0.0f);
+    m_start_scale.push_back(1.0f);
+    m_scale.push_back(1.0f);
+    m_time_to_live.push_back(0.0f);
+    m_fade_pos.push_back(1.0f);
+    m_color.push_back(white);
+
+    return m_pos_x.size() - 1;
+}
+
+template<class T> static inline void Swap_Remove(std::vector<T>& array, size_t index)
+{
+    array[index] = array.back();
+    array.pop_back();
+}
+
+void cParticle_Pool::Remove(size_t index)
+{
+    Swap_Remove(m_pos_x, index);
+    Swap_Remove(m_pos_y, index);
+    Swap_Remove(m_pos_z, index);
+    Swap_Remove(m_vel_x, index);
+    Swap_Remove(m_vel_y, index);
+    Swap_Remove(m_gravity_x, index);
+    Swap_Remove(m_gravity_y, index);
+    Swap_Remove(m_rot_x, index);
+    Swap_Remove(m_rot_y, index);
+    Swap_Remove(m_rot_z, index);
+    Swap_Remove(m_const_rot_x, index);
+    Swap_Remove(m_const_rot_y, index);
+    Swap_Remove(m_const_rot_z, index);
+    Swap_Remove(m_start_scale, index);
+    Swap_Remove(m_scale, index);
+    Swap_Remove(m_time_to_live, index);
+    Swap_Remove(m_fade_pos, index);
+    Swap_Remove(m_color, index);
+}
+
+/* Add the constant rotation of each particle
+ * wraps like cSprite::Set_Rotation_X but only calls fmod when needed
+*/
+static void Add_Particle_Rotation(float* rot, const float* const_rot, size_t count, float speed_factor)
 {
-    if (!m_image) {
-        return;
-    }
-
-    bool create_request = 0;
-
-    if (!request) {
-        create_request = 1;
-        // create request
-        request = new cSurface_Request();
-    }
-
-    Draw_Image_Normal(request);
-
-    // based on emitter position
-    if (m_parent->m_particle_based_on_emitter_pos > 0.0f) {
-        request->m_pos_x += (m_parent->m_pos_x * m_parent->m_particle_based_on_emitter_pos);
-        request->m_pos_y += (m_parent->m_pos_y * m_parent->m_particle_based_on_emitter_pos);
+    for (size_t i = 0; i < count; i++) {
+        rot[i] += const_rot[i] * speed_factor;
     }
 
-    // blending
-    if (m_parent->m_blending == BLEND_ADD) {
-        request->m_blend_sfactor = GL_SRC_ALPHA;
-        request->m_blend_dfactor = GL_ONE;
-    }
-    else if (m_parent->m_blending == BLEND_DRIVE) {
-        request->m_blend_sfactor = GL_SRC_COLOR;
-        request->m_blend_dfactor = GL_DST_ALPHA;
-    }
-
-    // color fading
-    if (m_parent->m_fade_color) {
-        request->m_color.red = static_cast<uint8_t>(m_color.red * m_fade_pos);
-        request->m_color.green = static_cast<uint8_t>(m_color.green * m_fade_pos);
-        request->m_color.blue = static_cast<uint8_t>(m_color.blue * m_fade_pos);
-    }
-
-    // alpha fading
-    if (m_parent->m_fade_alpha) {
-        request->m_color.alpha = static_cast<uint8_t>(request->m_color.alpha * m_fade_pos);
-    }
-
-    if (create_request) {
-        // add request
-        pRenderer->Add(request);
+    for (size_t i = 0; i < count; i++) {
+        if (rot[i] >= 360.0f || rot[i] <= -360.0f) {
+            rot[i] = fmod(rot[i], 360.0f);
+        }
     }
 }
 
-void cParticle::Set_Gravity(float x, float y)
-{
-    m_gravity_x = x;
-    m_gravity_y = y;
-}
-
 /* *** *** *** *** *** *** *** cParticle_Emitter *** *** *** *** *** *** *** *** *** *** */
 
 cParticle_Emitter::cParticle_Emitter(cSprite_Manager* sprite_manager)
@@ -570,6 +546,8 @@ void cParticle_Emitter::Init(void)
     m_sprite_array = ARRAY_ACTIVE;
     m_type = TYPE_PARTICLE_EMITTER;
     m_name = "Particle Emitter";
+    // emits and updates its particles everywhere
+    m_always_active = 1;
 
     m_emitter_based_on_camera_pos = 0;
     m_particle_based_on_emitter_pos = 0.0f;
@@ -735,10 +713,6 @@ void cParticle_Emitter::Pre_Update(void)
     // remove old particles
     Clear(0);
 
-    // update ahead
-    const float old_speedfactor = pFramerate->m_speed_factor;
-    pFramerate->m_speed_factor = 1.0f;
-
     float ttl;
 
     // todo : estimate this
@@ -750,12 +724,77 @@ void cParticle_Emitter::Pre_Update(void)
         ttl = m_time_to_live * speedfactor_fps;
     }
 
-    for (float i = 0.0f; i < ttl; i++) {
-        Update_Particles();
-        Update_Position();
+    // bouncing or deleting at the clip rect depends on the whole path
+    if (m_clip_rect.m_w > 0.0f && m_clip_rect.m_h > 0.0f && m_clip_mode != PCM_MOVE) {
+        // update ahead
+        const float old_speedfactor = pFramerate->m_speed_factor;
+        pFramerate->m_speed_factor = 1.0f;
+
+        for (float i = 0.0f; i < ttl; i++) {
+            Update_Particles();
+            Update_Position();
+        }
+
+        pFramerate->m_speed_factor = old_speedfactor;
+        return;
+    }
+
+    Update_Position();
+
+    if (!Can_Emit()) {
+        return;
+    }
+
+    const unsigned int frames = static_cast<unsigned int>(ceil(ttl));
+    const float fade_step = static_cast<float>(speedfactor_fps) * 0.001f;
+    // the longest possible particle time to live
+    float max_time_to_live = m_time_to_live;
+
+    if (m_time_to_live_rand > 0.0f) {
+        max_time_to_live += m_time_to_live_rand;
+    }
+
+    /* emit on the same frames as the simulation would and advance each
+     * particle by the frames left until the end
+    */
+    for (unsigned int i = 0; i < frames; i++) {
+        const unsigned int age = frames - 1 - i;
+        // skip particles which can not be alive anymore
+        const bool alive = m_time_to_live < 0.0f || age * fade_step < max_time_to_live;
+
+        while (m_emit_counter > m_emitter_iteration_interval) {
+            if (alive) {
+                const size_t first = m_particles.Size();
+                Emit();
+                Advance_Particles(first, age);
+            }
+
+            m_emit_counter -= m_emitter_iteration_interval;
+        }
+
+        m_emit_counter += fade_step;
     }
 
-    pFramerate->m_speed_factor = old_speedfactor;
+    // remove finished particles
+    for (size_t i = 0; i < m_particles.Size();) {
+        if (m_particles.m_fade_pos[i] <= 0.0f) {
+            m_particles.Remove(i);
+        }
+        else {
+            i++;
+        }
+    }
+
+    // move particles back into the clip rect as often as they would have left it
+    GL_rect clip_rect;
+
+    if (Get_Clip_Rect(clip_rect)) {
+        for (unsigned int i = 0; i < frames; i++) {
+            if (!Keep_Particles_In_Rect(clip_rect, PCM_MOVE)) {
+                break;
+            }
+        }
+    }
 }
 
 void cParticle_Emitter::Emit(void)
@@ -765,7 +804,7 @@ void cParticle_Emitter::Emit(void)
     }
 
     for (unsigned int i = 0; i < m_emitter_quota; i++) {
-        cParticle* particle = new cParticle(this);
+        const size_t num = m_particles.Add();
 
         // X Position
         float x = m_pos_x - (m_image->m_w * 0.5f);
@@ -778,15 +817,13 @@ void cParticle_Emitter::Emit(void)
             y += Get_Random_Float(0.0f, m_rect.m_h);
         }
         // Set Position
-        particle->Set_Pos(x, y, 1);
-
-        // Image
-        particle->Set_Image(m_image, 1);
+        m_particles.m_pos_x[num] = x;
+        m_particles.m_pos_y[num] = y;
 
         // Z position
-        particle->m_pos_z = m_pos_z;
+        m_particles.m_pos_z[num] = m_pos_z;
         if (m_pos_z_rand > 0.0f) {
-            particle->m_pos_z += Get_Random_Float(0.0f, m_pos_z_rand);
+            m_particles.m_pos_z[num] += Get_Random_Float(0.0f, m_pos_z_rand);
         }
 
         // angle range
@@ -802,30 +839,31 @@ void cParticle_Emitter::Emit(void)
             speed += Get_Random_Float(0.0f, m_vel_rand);
         }
         // Set Velocity
-        particle->Set_Velocity_From_Angle(dir_angle, speed, 1);
+        m_particles.m_vel_x[num] = cos(dir_angle * deg_to_rad) * speed;
+        m_particles.m_vel_y[num] = sin(dir_angle * deg_to_rad) * speed;
 
         // Start rotation
-        particle->m_rot_x = m_start_rot_x;
-        particle->m_rot_y = m_start_rot_y;
-        particle->m_rot_z = m_start_rot_z;
+        m_particles.m_rot_x[num] = m_start_rot_x;
+        m_particles.m_rot_y[num] = m_start_rot_y;
+        m_particles.m_rot_z[num] = m_start_rot_z;
 
         // Start direction is added to the z rotation
         if (m_start_rot_z_uses_direction) {
-            particle->m_rot_z += dir_angle;
+            m_particles.m_rot_z[num] += dir_angle;
         }
 
         // Constant rotation
-        particle->m_const_rot_x = m_const_rot_x;
-        particle->m_const_rot_y = m_const_rot_y;
-        particle->m_const_rot_z = m_const_rot_z;
+        m_particles.m_const_rot_x[num] = m_const_rot_x;
+        m_particles.m_const_rot_y[num] = m_const_rot_y;
+        m_particles.m_const_rot_z[num] = m_const_rot_z;
         if (m_const_rot_x_rand > 0.0f) {
-            particle->m_const_rot_x += Get_Random_Float(0.0f, m_const_rot_x_rand);
+            m_particles.m_const_rot_x[num] += Get_Random_Float(0.0f, m_const_rot_x_rand);
         }
         if (m_const_rot_y_rand > 0.0f) {
-            particle->m_const_rot_y += Get_Random_Float(0.0f, m_const_rot_y_rand);
+            m_particles.m_const_rot_y[num] += Get_Random_Float(0.0f, m_const_rot_y_rand);
         }
         if (m_const_rot_z_rand > 0.0f) {
-            particle->m_const_rot_z += Get_Random_Float(0.0f, m_const_rot_z_rand);
+            m_particles.m_const_rot_z[num] += Get_Random_Float(0.0f, m_const_rot_z_rand);
         }
 
         // Scale
@@ -833,7 +871,11 @@ void cParticle_Emitter::Emit(void)
         if (m_size_scale_rand > 0.0f) {
             scale += Get_Random_Float(0.0f, m_size_scale_rand);
         }
-        particle->Set_Scale(scale, 1);
+        // invalid scale is ignored like in cSprite::Set_Scale
+        if (!Is_Float_Equal(scale, 0.0f)) {
+            m_particles.m_start_scale[num] = scale;
+            m_particles.m_scale[num] = scale;
+        }
 
         // Gravity
         float grav_x = m_gravity_x;
@@ -845,41 +887,37 @@ void cParticle_Emitter::Emit(void)
             grav_y += Get_Random_Float(0.0f, m_gravity_y_rand);
         }
         // set Gravity
-        particle->Set_Gravity(grav_x, grav_y);
+        m_particles.m_gravity_x[num] = grav_x;
+        m_particles.m_gravity_y[num] = grav_y;
 
         // Color
-        particle->Set_Color(m_color);
+        Color& color = m_particles.m_color[num];
+        color = m_color;
         if (m_color_rand.red > 0) {
-            particle->m_color.red += rand() % m_color_rand.red;
+            color.red += rand() % m_color_rand.red;
         }
         if (m_color_rand.green > 0) {
-            particle->m_color.green += rand() % m_color_rand.green;
+            color.green += rand() % m_color_rand.green;
         }
         if (m_color_rand.blue > 0) {
-            particle->m_color.blue += rand() % m_color_rand.blue;
+            color.blue += rand() % m_color_rand.blue;
         }
         if (m_color_rand.alpha > 0) {
-            particle->m_color.alpha += rand() % m_color_rand.alpha;
+            color.alpha += rand() % m_color_rand.alpha;
         }
 
         // Time to life
-        particle->m_time_to_live = m_time_to_live;
+        m_particles.m_time_to_live[num] = m_time_to_live;
         if (m_time_to_live_rand > 0.0f) {
-            particle->m_time_to_live += Get_Random_Float(0.0f, m_time_to_live_rand);
+            m_particles.m_time_to_live[num] += Get_Random_Float(0.0f, m_time_to_live_rand);
         }
-
-        m_objects.push_back(particle);
     }
 }
 
 void cParticle_Emitter::Clear(bool reset /* = 1 */)
 {
     // clear particles
-    for (ParticleList::iterator itr = m_objects.begin(); itr != m_objects.end(); ++itr) {
-        delete *itr;
-    }
-
-    m_objects.clear();
+    m_particles.Clear();
 
     // clear animation data
     m_emit_counter = 0.0f;
@@ -906,27 +944,63 @@ void cParticle_Emitter::Update(void)
 
 void cParticle_Emitter::Update_Particles(void)
 {
-    // update objects
-    for (ParticleList::iterator itr = m_objects.begin(); itr != m_objects.end();) {
-        // get object pointer
-        cParticle* obj = (*itr);
+    const size_t count = m_particles.Size();
+    const float speed_factor = pFramerate->m_speed_factor;
+    const float fade_step = (static_cast<float>(speedfactor_fps) * 0.001f) * speed_factor;
+
+    // plain arrays so the loops below can be vectorized
+    float* pos_x = m_particles.m_pos_x.data();
+    float* pos_y = m_particles.m_pos_y.data();
+    float* vel_x = m_particles.m_vel_x.data();
+    float* vel_y = m_particles.m_vel_y.data();
+    const float* gravity_x = m_particles.m_gravity_x.data();
+    const float* gravity_y = m_particles.m_gravity_y.data();
+    const float* start_scale = m_particles.m_start_scale.data();
+    float* scale = m_particles.m_scale.data();
+    const float* time_to_live = m_particles.m_time_to_live.data();
+    float* fade_pos = m_particles.m_fade_pos.data();
 
-        // update
-        obj->Update();
+    // update fade modifier
+    for (size_t i = 0; i < count; i++) {
+        fade_pos[i] -= fade_step / time_to_live[i];
+    }
 
-        // if finished
-        if (!obj->m_active) {
-            itr = m_objects.erase(itr);
-            delete obj;
+    // with size fading
+    if (m_fade_size) {
+        for (size_t i = 0; i < count; i++) {
+            scale[i] = start_scale[i] * fade_pos[i];
+        }
+    }
+
+    // move
+    for (size_t i = 0; i < count; i++) {
+        pos_x[i] += vel_x[i] * speed_factor;
+        pos_y[i] += vel_y[i] * speed_factor;
+    }
+
+    // todo : gravity maximum
+    for (size_t i = 0; i < count; i++) {
+        vel_x[i] += gravity_x[i] * speed_factor;
+        vel_y[i] += gravity_y[i] * speed_factor;
+    }
+
+    // constant rotation
+    Add_Particle_Rotation(m_particles.m_rot_x.data(), m_particles.m_const_rot_x.data(), count, speed_factor);
+    Add_Particle_Rotation(m_particles.m_rot_y.data(), m_particles.m_const_rot_y.data(), count, speed_factor);
+    Add_Particle_Rotation(m_particles.m_rot_z.data(), m_particles.m_const_rot_z.data(), count, speed_factor);
+
+    // remove finished particles
+    for (size_t i = 0; i < m_particles.Size();) {
+        if (m_particles.m_fade_pos[i] <= 0.0f) {
+            m_particles.Remove(i);
         }
-        // increment
         else {
-            ++itr;
+            i++;
         }
     }
 
     // if able to emit or endless emitter
-    if (m_emitter_living_time < m_emitter_time_to_live || Is_Float_Equal(m_emitter_time_to_live, -1.0f)) {
+    if (Can_Emit()) {
         // emit
         while (m_emit_counter > m_emitter_iteration_interval) {
             Emit();
@@ -936,7 +1010,7 @@ void cParticle_Emitter::Update_Particles(void)
         m_emit_counter += pFramerate->m_speed_factor * (static_cast<float>(speedfactor_fps) * 0.001f);
     }
     // no particles are active
-    else if (m_objects.empty()) {
+    else if (m_particles.Empty()) {
         Set_Active(0);
     }
 }
@@ -947,30 +1021,80 @@ void cParticle_Emitter::Update_Position(void)
         Set_Pos(m_start_pos_x + pActive_Camera->m_x, m_start_pos_y + (pActive_Camera->m_y + game_res_h));
     }
 
+    GL_rect clip_rect_final;
+
     // if clip rect is set
-    if (m_clip_rect.m_w > 0.0f && m_clip_rect.m_h > 0.0f) {
-        GL_rect clip_rect_final;
+    if (Get_Clip_Rect(clip_rect_final)) {
+        Keep_Particles_In_Rect(clip_rect_final, m_clip_mode);
+    }
+}
 
-        clip_rect_final.m_x = m_start_pos_x + m_clip_rect.m_x;
-        clip_rect_final.m_y = m_start_pos_y + m_clip_rect.m_y;
+bool cParticle_Emitter::Get_Clip_Rect(GL_rect& clip_rect) const
+{
+    if (m_clip_rect.m_w <= 0.0f || m_clip_rect.m_h <= 0.0f) {
+        return 0;
+    }
 
-        if (!editor_enabled) {
-            if (m_emitter_based_on_camera_pos) {
-                clip_rect_final.m_x += pActive_Camera->m_x;
-                clip_rect_final.m_y += pActive_Camera->m_y + game_res_h;
-            }
+    clip_rect.m_x = m_start_pos_x + m_clip_rect.m_x;
+    clip_rect.m_y = m_start_pos_y + m_clip_rect.m_y;
 
-            if (m_particle_based_on_emitter_pos > 0.0f) {
-                clip_rect_final.m_x -= m_pos_x * m_particle_based_on_emitter_pos;
-                clip_rect_final.m_y -= m_pos_y * m_particle_based_on_emitter_pos;
-            }
+    if (!editor_enabled) {
+        if (m_emitter_based_on_camera_pos) {
+            clip_rect.m_x += pActive_Camera->m_x;
+            clip_rect.m_y += pActive_Camera->m_y + game_res_h;
+        }
+
+        if (m_particle_based_on_emitter_pos > 0.0f) {
+            clip_rect.m_x -= m_pos_x * m_particle_based_on_emitter_pos;
+            clip_rect.m_y -= m_pos_y * m_particle_based_on_emitter_pos;
         }
+    }
 
-        clip_rect_final.m_w = m_clip_rect.m_w;
-        clip_rect_final.m_h = m_clip_rect.m_h;
+    clip_rect.m_w = m_clip_rect.m_w;
+    clip_rect.m_h = m_clip_rect.m_h;
 
-        Keep_Particles_In_Rect(clip_rect_final, m_clip_mode);
+    return 1;
+}
+
+bool cParticle_Emitter::Can_Emit(void) const
+{
+    // if able to emit or endless emitter
+    return m_emitter_living_time < m_emitter_time_to_live || Is_Float_Equal(m_emitter_time_to_live, -1.0f);
+}
+
+void cParticle_Emitter::Advance_Particles(size_t first, unsigned int frames)
+{
+    if (frames == 0) {
+        return;
+    }
+
+    /* closed form of calling Update_Particles frames times with a speed factor of 1
+     * the position moves with the velocity before gravity is added
+    */
+    const float count = static_cast<float>(frames);
+    const float gravity_count = (count * (count - 1.0f)) * 0.5f;
+    const float fade = (static_cast<float>(speedfactor_fps) * 0.001f) * count;
+
+    for (size_t i = first; i < m_particles.Size(); i++) {
+        m_particles.m_fade_pos[i] -= fade / m_particles.m_time_to_live[i];
+
+        // with size fading
+        if (m_fade_size) {
+            m_particles.m_scale[i] = m_particles.m_start_scale[i] * m_particles.m_fade_pos[i];
+        }
+
+        m_particles.m_pos_x[i] += (m_particles.m_vel_x[i] * count) + (m_particles.m_gravity_x[i] * gravity_count);
+        m_particles.m_pos_y[i] += (m_particles.m_vel_y[i] * count) + (m_particles.m_gravity_y[i] * gravity_count);
+        m_particles.m_vel_x[i] += m_particles.m_gravity_x[i] * count;
+        m_particles.m_vel_y[i] += m_particles.m_gravity_y[i] * count;
     }
+
+    // constant rotation
+    const size_t size = m_particles.Size() - first;
+
+    Add_Particle_Rotation(m_particles.m_rot_x.data() + first, m_particles.m_const_rot_x.data() + first, size, count);
+    Add_Particle_Rotation(m_particles.m_rot_y.data() + first, m_particles.m_const_rot_y.data() + first, size, count);
+    Add_Particle_Rotation(m_particles.m_rot_z.data() + first, m_particles.m_const_rot_z.data() + first, size, count);
 }
 
 void cParticle_Emitter::Draw(cSurface_Request* request /* = NULL */)
@@ -979,9 +1103,7 @@ void cParticle_Emitter::Draw(cSurface_Request* request /* = NULL */)
         return;
     }
 
-    for (ParticleList::iterator itr = m_objects.begin(); itr != m_objects.end(); ++itr) {
-        (*itr)->Draw();
-    }
+    Draw_Particles();
 
     if (editor_enabled) {
         if (!m_spawned) {
@@ -1010,96 +1132,185 @@ void cParticle_Emitter::Draw(cSurface_Request* request /* = NULL */)
     }
 }
 
-void cParticle_Emitter::Keep_Particles_In_Rect(const GL_rect& clip_rect, ParticleClipMode mode /* = PCM_MOVE */)
+void cParticle_Emitter::Draw_Particles(void)
+{
+    if (!m_image || m_particles.Empty()) {
+        return;
+    }
+
+    const size_t count = m_particles.Size();
+
+    // all particles share the image and blending
+    cSurface_Batch_Request* request = new cSurface_Batch_Request();
+    request->m_texture_id = m_image->Get_Texture();
+    request->m_w = m_image->m_start_w;
+    request->m_h = m_image->m_start_h;
+    request->m_content_w = m_image->m_content_w;
+    request->m_content_h = m_image->m_content_h;
+    request->m_rot_x = m_image->m_base_rot_x;
+    request->m_rot_y = m_image->m_base_rot_y;
+    request->m_rot_z = m_image->m_base_rot_z;
+    // particles are never below the emitter
+    request->m_pos_z = m_pos_z;
+    request->m_no_camera = 0;
+
+    // blending
+    if (m_blending == BLEND_ADD) {
+        request->m_blend_sfactor = GL_SRC_ALPHA;
+        request->m_blend_dfactor = GL_ONE;
+    }
+    else if (m_blending == BLEND_DRIVE) {
+        request->m_blend_sfactor = GL_SRC_COLOR;
+        request->m_blend_dfactor = GL_DST_ALPHA;
+    }
+
+    // based on emitter position
+    float offset_x = 0.0f;
+    float offset_y = 0.0f;
+
+    if (m_particle_based_on_emitter_pos > 0.0f) {
+        offset_x = m_pos_x * m_particle_based_on_emitter_pos;
+        offset_y = m_pos_y * m_particle_based_on_emitter_pos;
+    }
+
+    request->m_items.resize(count);
+
+    for (size_t i = 0; i < count; i++) {
+        cSurface_Batch_Item& item = request->m_items[i];
+        const float scale = m_particles.m_scale[i];
+        const float fade_pos = m_particles.m_fade_pos[i];
+
+        // centered scaling as in cSprite::Draw_Image_Normal
+        item.m_pos_x = m_particles.m_pos_x[i] + (m_image->m_int_x * scale) - ((m_image->m_w * 0.5f) * (scale - 1.0f)) + offset_x;
+        item.m_pos_y = m_particles.m_pos_y[i] + (m_image->m_int_y * scale) - ((m_image->m_h * 0.5f) * (scale - 1.0f)) + offset_y;
+        item.m_pos_z = m_particles.m_pos_z[i];
+        item.m_scale_x = scale;
+        item.m_scale_y = scale;
+        item.m_rot_x = m_particles.m_rot_x[i];
+        item.m_rot_y = m_particles.m_rot_y[i];
+        item.m_rot_z = m_particles.m_rot_z[i];
+        item.m_color = m_particles.m_color[i];
+
+        // color fading
+        if (m_fade_color) {
+            item.m_color.red = static_cast<uint8_t>(item.m_color.red * fade_pos);
+            item.m_color.green = static_cast<uint8_t>(item.m_color.green * fade_pos);
+            item.m_color.blue = static_cast<uint8_t>(item.m_color.blue * fade_pos);
+        }
+
+        // alpha fading
+        if (m_fade_alpha) {
+            item.m_color.alpha = static_cast<uint8_t>(item.m_color.alpha * fade_pos);
+        }
+    }
+
+    pRenderer->Add(request);
+}
+
+bool cParticle_Emitter::Keep_Particles_In_Rect(const GL_rect& clip_rect, ParticleClipMode mode /* = PCM_MOVE */)
 {
+    if (!m_image) {
+        return 0;
+    }
+
     // temporary obj rect
     GL_rect obj_rect;
+    bool outside = 0;
 
     // find particles that are not visible and move them to the opposite screen side
-    for (ParticleList::iterator itr = m_objects.begin(); itr != m_objects.end(); ++itr) {
-        // get animation particle pointer
-        cParticle* obj = static_cast<cParticle*>(*itr);
+    for (size_t i = 0; i < m_particles.Size();) {
+        float& pos_x = m_particles.m_pos_x[i];
+        float& pos_y = m_particles.m_pos_y[i];
+        float& vel_x = m_particles.m_vel_x[i];
+        float& vel_y = m_particles.m_vel_y[i];
+        const float scale = m_particles.m_scale[i];
 
         // set rectangle
-        if (obj->m_scale_x != 1.0f) {
-            obj_rect.m_x = obj->m_pos_x - ((obj->m_image->m_w * 0.5f) * (obj->m_scale_x - 1.0f));
-            obj_rect.m_w = obj->m_rect.m_w * obj->m_scale_x;
-        }
-        else {
-            obj_rect.m_x = obj->m_pos_x;
-            obj_rect.m_w = obj->m_rect.m_w;
-        }
+        obj_rect.m_x = pos_x - ((m_image->m_w * 0.5f) * (scale - 1.0f));
+        obj_rect.m_w = m_image->m_w * scale;
+        obj_rect.m_y = pos_y - ((m_image->m_h * 0.5f) * (scale - 1.0f));
+        obj_rect.m_h = m_image->m_h * scale;
 
-        if (obj->m_scale_y != 1.0f) {
-            obj_rect.m_y = obj->m_pos_y - ((obj->m_image->m_h * 0.5f) * (obj->m_scale_y - 1.0f));
-            obj_rect.m_h = obj->m_rect.m_h * obj->m_scale_y;
-        }
-        else {
-            obj_rect.m_y = obj->m_pos_y;
-            obj_rect.m_h = obj->m_rect.m_h;
-        }
+        bool remove = 0;
 
         // out in left
         if (obj_rect.m_x + obj_rect.m_w < clip_rect.m_x) {
+            outside = 1;
+
             // move to right
             if (mode == PCM_MOVE) {
-                obj->Move(clip_rect.m_w + obj_rect.m_w - 1.0f, 0, 1);
+                pos_x += clip_rect.m_w + obj_rect.m_w - 1.0f;
             }
             else if (mode == PCM_REVERSE) {
-                if (obj->m_velx < 0.0f) {
-                    obj->Set_Velocity(-obj->m_velx, obj->m_vely);
+                if (vel_x < 0.0f) {
+                    vel_x = -vel_x;
                 }
             }
             else if (mode == PCM_DELETE) {
-                obj->Set_Active(0);
+                remove = 1;
             }
         }
         // out in right
         else if (obj_rect.m_x > clip_rect.m_x + clip_rect.m_w) {
+            outside = 1;
+
             // move to left
             if (mode == PCM_MOVE) {
-                obj->Move(-clip_rect.m_w - obj_rect.m_w + 1.0f, 0, 1);
+                pos_x += -clip_rect.m_w - obj_rect.m_w + 1.0f;
             }
             else if (mode == PCM_REVERSE) {
-                if (obj->m_velx > 0.0f) {
-                    obj->Set_Velocity(-obj->m_velx, obj->m_vely);
+                if (vel_x > 0.0f) {
+                    vel_x = -vel_x;
                 }
             }
             else if (mode == PCM_DELETE) {
-                obj->Set_Active(0);
+                remove = 1;
             }
         }
         // out on top
         else if (obj_rect.m_y + obj_rect.m_h < clip_rect.m_y) {
+            outside = 1;
+
             // move to bottom
             if (mode == PCM_MOVE) {
-                obj->Move(0, clip_rect.m_h + obj_rect.m_h - 1.0f, 1);
+                pos_y += clip_rect.m_h + obj_rect.m_h - 1.0f;
             }
             else if (mode == PCM_REVERSE) {
-                if (obj->m_vely < 0.0f) {
-                    obj->Set_Velocity(obj->m_velx, -obj->m_vely);
+                if (vel_y < 0.0f) {
+                    vel_y = -vel_y;
                 }
             }
             else if (mode == PCM_DELETE) {
-                obj->Set_Active(0);
+                remove = 1;
             }
         }
         // out on bottom
         else if (obj_rect.m_y > clip_rect.m_y + clip_rect.m_h) {
+            outside = 1;
+
             // move to top
             if (mode == PCM_MOVE) {
-                obj->Move(0, -clip_rect.m_h - obj_rect.m_h + 1.0f, 1);
+                pos_y += -clip_rect.m_h - obj_rect.m_h + 1.0f;
             }
             else if (mode == PCM_REVERSE) {
-                if (obj->m_vely > 0.0f) {
-                    obj->Set_Velocity(obj->m_velx, -obj->m_vely);
+                if (vel_y > 0.0f) {
+                    vel_y = -vel_y;
                 }
             }
             else if (mode == PCM_DELETE) {
-                obj->Set_Active(0);
+                remove = 1;
             }
         }
+
+        if (remove) {
+            m_particles.Remove(i);
+        }
+        else {
+            i++;
+        }
     }
+
+    return outside;
 }
 
 bool cParticle_Emitter::Is_Update_Valid()
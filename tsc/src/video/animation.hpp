@@ -116,39 +116,58 @@ namespace TSC {
         FireAnimList m_objects;
     };
 
-    /* *** *** *** *** *** *** *** Particle Emitter item *** *** *** *** *** *** *** *** *** *** */
-
-// forward declare
-    class cParticle_Emitter;
-
-// Particle Item
-    class cParticle : public cMovingSprite {
+    /* *** *** *** *** *** *** *** Particle Pool *** *** *** *** *** *** *** *** *** *** */
+
+    /* Particles of an emitter stored as a structure of arrays
+     * Every attribute has its own contiguous array so the per-frame
+     * integration runs as plain loops over floats. Finished particles are
+     * removed by moving the last particle into their slot.
+    */
+    class cParticle_Pool {
     public:
-        cParticle(cParticle_Emitter* parent);
-        virtual ~cParticle(void);
-
-        // update
-        virtual void Update(void);
-        // draw
-        virtual void Draw(cSurface_Request* request = NULL);
-
-        // set gravity
-        void Set_Gravity(float x, float y);
-
-        // parent particle emitter
-        cParticle_Emitter* m_parent;
-        // time to live
-        float m_time_to_live;
+        // number of particles
+        inline size_t Size(void) const
+        {
+            return m_pos_x.size();
+        };
+        inline bool Empty(void) const
+        {
+            return m_pos_x.empty();
+        };
+        // remove all particles
+        void Clear(void);
+        // add a particle with default values and return its index
+        size_t Add(void);
+        // remove the particle by moving the last particle into its slot
+        void Remove(size_t index);
+
+        // position
+        std::vector<float> m_pos_x;
+        std::vector<float> m_pos_y;
+        std::vector<float> m_pos_z;
+        // velocity
+        std::vector<float> m_vel_x;
+        std::vector<float> m_vel_y;
+        // gravity
+        std::vector<float> m_gravity_x;
+        std::vector<float> m_gravity_y;
+        // rotation
+        std::vector<float> m_rot_x;
+        std::vector<float> m_rot_y;
+        std::vector<float> m_rot_z;
         // constant rotation
-        float m_const_rot_x;
-        float m_const_rot_y;
-        float m_const_rot_z;
-        // particle gravity
-        float m_gravity_x;
-        float m_gravity_y;
-
+        std::vector<float> m_const_rot_x;
+        std::vector<float> m_const_rot_y;
+        std::vector<float> m_const_rot_z;
+        // scale
+        std::vector<float> m_start_scale;
+        std::vector<float> m_scale;
+        // time to live
+        std::vector<float> m_time_to_live;
         // fading position value
-        float m_fade_pos;
+        std::vector<float> m_fade_pos;
+        // color
+        std::vector<Color> m_color;
     };
 
     /* *** *** *** *** *** *** *** Particle Emitter *** *** *** *** *** *** *** *** *** *** */
@@ -181,7 +200,10 @@ namespace TSC {
             return mrb_obj_value(Data_Wrap_Struct(p_state, mrb_class_get(p_state, "ParticleEmitter"), &Scripting::rtTSC_Scriptable, this));
         }
 
-        // pre-update animation
+        /* pre-update animation
+         * spawns the particles directly in the state they would have after
+         * simulating their time to live
+        */
         void Pre_Update(void);
         // Emit Particles
         virtual void Emit(void);
@@ -196,11 +218,21 @@ namespace TSC {
         void Update_Particles(void);
         // update position and clipping
         void Update_Position(void);
+        // get the final clip rectangle, returns false if not clipped
+        bool Get_Clip_Rect(GL_rect& clip_rect) const;
+        // if the emitter is still allowed to emit particles
+        bool Can_Emit(void) const;
+        // advance the particles starting at the given index by the given number of frames
+        void Advance_Particles(size_t first, unsigned int frames);
         // Draw everything
         virtual void Draw(cSurface_Request* request = NULL);
+        // Draw all particles as one batch
+        void Draw_Particles(void);
 
-        // keep particles in the given rectangle
-        void Keep_Particles_In_Rect(const GL_rect& clip_rect, ParticleClipMode mode = PCM_MOVE);
+        /* keep particles in the given rectangle
+         * returns true if a particle was outside
+        */
+        bool Keep_Particles_In_Rect(const GL_rect& clip_rect, ParticleClipMode mode = PCM_MOVE);
 
         // if update is valid for the current state
         virtual bool Is_Update_Valid();
@@ -311,8 +343,7 @@ namespace TSC {
         bool Editor_Clip_Mode_Select(const CEGUI::EventArgs& event);
 
         // Particle items
-        typedef vector<cParticle*> ParticleList;
-        ParticleList m_objects;
+        cParticle_Pool m_particles;
 
         // filename of the particle image
         boost::filesystem::path m_image_filename;
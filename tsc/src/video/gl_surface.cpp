@@ -30,6 +30,24 @@ namespace TSC {
 
 /* *** *** *** *** *** *** *** *** cGL_Surface *** *** *** *** *** *** *** *** *** */
 
+// Delete the texture after the frames already passed to the render thread
+static void Delete_Texture(GLuint image)
+{
+    auto delete_texture = [image]() {
+        if (glIsTexture(image)) {
+            glDeleteTextures(1, &image);
+        }
+    };
+
+    if (pVideo) {
+        pVideo->m_render_thread.Post(delete_texture);
+    }
+    // the video is deleted first on exit
+    else {
+        delete_texture();
+    }
+}
+
 cGL_Surface::cGL_Surface(void)
 {
     m_image = 0;
@@ -42,6 +60,8 @@ cGL_Surface::cGL_Surface(void)
     m_h = 0;
     m_tex_w = 0;
     m_tex_h = 0;
+    m_content_w = 1.0f;
+    m_content_h = 1.0f;
 
     // internal rotation data
     m_base_rot_x = 0;
@@ -57,6 +77,8 @@ cGL_Surface::cGL_Surface(void)
     m_auto_del_img = 1;
     m_managed = 0;
     m_obsolete = 0;
+    m_used_frame = 0;
+    m_evicted = 0;
 
     // default massive type is passive
     m_massive_type = MASS_PASSIVE;
@@ -69,8 +91,8 @@ cGL_Surface::cGL_Surface(void)
 cGL_Surface::~cGL_Surface(void)
 {
     // don't delete a managed OpenGL image if still in use by another managed cGL_Surface
-    if (m_auto_del_img && glIsTexture(m_image) && (!m_managed || !Is_Texture_Use_Multiple())) {
-        glDeleteTextures(1, &m_image);
+    if (m_auto_del_img && m_image && (!m_managed || !Is_Texture_Use_Multiple())) {
+        Delete_Texture(m_image);
     }
 
     if (destruction_function) {
@@ -93,6 +115,8 @@ cGL_Surface* cGL_Surface::Copy(void) const
     new_surface->m_h = m_h;
     new_surface->m_tex_h = m_tex_h;
     new_surface->m_tex_w = m_tex_w;
+    new_surface->m_content_w = m_content_w;
+    new_surface->m_content_h = m_content_h;
     new_surface->m_base_rot_x = m_base_rot_x;
     new_surface->m_base_rot_y = m_base_rot_y;
     new_surface->m_base_rot_z = m_base_rot_z;
@@ -103,6 +127,7 @@ cGL_Surface* cGL_Surface::Copy(void) const
 
     // settings
     new_surface->m_obsolete = m_obsolete;
+    new_surface->m_evicted = m_evicted;
     new_surface->m_editor_tags = m_editor_tags;
     new_surface->m_name = m_name;
     new_surface->m_massive_type = m_massive_type;
@@ -137,7 +162,7 @@ void cGL_Surface::Blit(float x, float y, float z, cSurface_Request* request /* =
 void cGL_Surface::Blit_Data(cSurface_Request* request) const
 {
     // texture id
-    request->m_texture_id = m_image;
+    request->m_texture_id = Get_Texture();
 
     // position
     request->m_pos_x += m_int_x;
@@ -146,6 +171,8 @@ void cGL_Surface::Blit_Data(cSurface_Request* request) const
     // size
     request->m_w = m_start_w;
     request->m_h = m_start_h;
+    request->m_content_w = m_content_w;
+    request->m_content_h = m_content_h;
 
     // rotation
     request->m_rot_x += m_base_rot_x;
@@ -160,13 +187,15 @@ void cGL_Surface::Save(const std::string& filename)
         return;
     }
 
-    // bind the texture
-    glBindTexture(GL_TEXTURE_2D, m_image);
-
     // create image data
     GLubyte* data = new GLubyte[m_tex_w * m_tex_h * 4];
-    // read texture
-    glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, static_cast<GLvoid*>(data));
+
+    pVideo->m_render_thread.Run([this, data]() {
+        // bind the texture
+        glBindTexture(GL_TEXTURE_2D, m_image);
+        // read texture
+        glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, static_cast<GLvoid*>(data));
+    });
     // save
     pVideo->Save_Surface(filename, data, m_tex_w, m_tex_h);
     // clear data
@@ -201,36 +230,38 @@ cSaved_Texture* cGL_Surface::Get_Software_Texture(bool only_filename /* = 0 */)
 
     // hardware texture to software texture
     if (!only_filename) {
-        // bind the texture
-        glBindTexture(GL_TEXTURE_2D, m_image);
-
-        // texture settings
-        glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &soft_tex->m_width);
-        glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &soft_tex->m_height);
-        glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_INTERNAL_FORMAT, &soft_tex->m_format);
-
-        glGetTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, &soft_tex->m_wrap_s);
-        glGetTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, &soft_tex->m_wrap_t);
-        glGetTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, &soft_tex->m_min_filter);
-        glGetTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, &soft_tex->m_mag_filter);
-
-        unsigned int bpp;
-
-        if (soft_tex->m_format == GL_RGBA) {
-            bpp = 4;
-        }
-        else if (soft_tex->m_format == GL_RGB) {
-            bpp = 3;
-        }
-        else {
-            bpp = 4;
-            cerr << "Warning: cGL_Surface :: Get_Software_Texture : Unknown format" << endl;
-        }
-
-        // texture data
-        soft_tex->m_pixels = new GLubyte[soft_tex->m_width * soft_tex->m_height * bpp];
-
-        glGetTexImage(GL_TEXTURE_2D, 0, soft_tex->m_format, GL_UNSIGNED_BYTE, soft_tex->m_pixels);
+        pVideo->m_render_thread.Run([this, soft_tex]() {
+            // bind the texture
+            glBindTexture(GL_TEXTURE_2D, m_image);
+
+            // texture settings
+            glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &soft_tex->m_width);
+            glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &soft_tex->m_height);
+            glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_INTERNAL_FORMAT, &soft_tex->m_format);
+
+            glGetTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, &soft_tex->m_wrap_s);
+            glGetTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, &soft_tex->m_wrap_t);
+            glGetTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, &soft_tex->m_min_filter);
+            glGetTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, &soft_tex->m_mag_filter);
+
+            unsigned int bpp;
+
+            if (soft_tex->m_format == GL_RGBA) {
+                bpp = 4;
+            }
+            else if (soft_tex->m_format == GL_RGB) {
+                bpp = 3;
+            }
+            else {
+                bpp = 4;
+                cerr << "Warning: cGL_Surface :: Get_Software_Texture : Unknown format" << endl;
+            }
+
+            // texture data
+            soft_tex->m_pixels = new GLubyte[soft_tex->m_width * soft_tex->m_height * bpp];
+
+            glGetTexImage(GL_TEXTURE_2D, 0, soft_tex->m_format, GL_UNSIGNED_BYTE, soft_tex->m_pixels);
+        });
     }
 
     // surface pointer
@@ -248,25 +279,28 @@ void cGL_Surface::Load_Software_Texture(cSaved_Texture* soft_tex)
     // software texture
     if (soft_tex->m_pixels) {
         GLuint tex_id;
-        glGenTextures(1, &tex_id);
 
-        glBindTexture(GL_TEXTURE_2D, tex_id);
+        pVideo->m_render_thread.Run([&tex_id, soft_tex]() {
+            glGenTextures(1, &tex_id);
 
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, soft_tex->m_wrap_s);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, soft_tex->m_wrap_t);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, soft_tex->m_min_filter);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, soft_tex->m_mag_filter);
+            glBindTexture(GL_TEXTURE_2D, tex_id);
 
-        // check if mipmaps are enabled
-        bool mipmaps = 0;
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, soft_tex->m_wrap_s);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, soft_tex->m_wrap_t);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, soft_tex->m_min_filter);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, soft_tex->m_mag_filter);
 
-        // if mipmaps are enabled
-        if (soft_tex->m_min_filter == GL_LINEAR_MIPMAP_LINEAR) {
-            mipmaps = 1;
-        }
+            // check if mipmaps are enabled
+            bool mipmaps = 0;
+
+            // if mipmaps are enabled
+            if (soft_tex->m_min_filter == GL_LINEAR_MIPMAP_LINEAR) {
+                mipmaps = 1;
+            }
 
-        // Create Hardware Texture
-        pVideo->Create_GL_Texture(soft_tex->m_width, soft_tex->m_height, soft_tex->m_pixels, mipmaps);
+            // Create Hardware Texture
+            pVideo->Create_GL_Texture(soft_tex->m_width, soft_tex->m_height, soft_tex->m_pixels, mipmaps);
+        });
 
         m_image = tex_id;
     }
@@ -279,15 +313,65 @@ void cGL_Surface::Load_Software_Texture(cSaved_Texture* soft_tex)
             return;
         }
 
-        // get image
-        m_image = surface_copy->m_image;
-        m_tex_w = surface_copy->m_tex_w;
-        m_tex_h = surface_copy->m_tex_h;
-        // keep hardware texture
-        surface_copy->m_auto_del_img = 0;
-        // delete copy
-        delete surface_copy;
+        Take_Texture(surface_copy);
+    }
+}
+
+void cGL_Surface::Take_Texture(cGL_Surface* surface)
+{
+    // loaded now if it was pending
+    m_evicted = 0;
+    // get image
+    m_image = surface->m_image;
+    m_tex_w = surface->m_tex_w;
+    m_tex_h = surface->m_tex_h;
+    m_content_w = surface->m_content_w;
+    m_content_h = surface->m_content_h;
+    // keep hardware texture
+    surface->m_auto_del_img = 0;
+    // delete copy
+    delete surface;
+}
+
+GLuint cGL_Surface::Get_Texture(void) const
+{
+    m_used_frame = pImage_Manager->m_frame;
+
+    if (m_evicted) {
+        cGL_Surface* surface = const_cast<cGL_Surface*>(this);
+        surface->m_evicted = 0;
+
+        cGL_Surface* surface_copy = pVideo->Load_GL_Surface(m_path);
+
+        if (surface_copy) {
+            surface->Take_Texture(surface_copy);
+        }
+        else {
+            cerr << "Warning: cGL_Surface :: Get_Texture " << path_to_utf8(m_path) << " reloading failed" << endl;
+        }
+    }
+
+    return m_image;
+}
+
+void cGL_Surface::Evict_Texture(void)
+{
+    if (!m_image || m_path.empty()) {
+        return;
     }
+
+    Delete_Texture(m_image);
+    m_image = 0;
+    m_evicted = 1;
+}
+
+size_t cGL_Surface::Get_Texture_Memory(void) const
+{
+    if (!m_image) {
+        return 0;
+    }
+
+    return m_tex_w * m_tex_h * 4;
 }
 
 fs::path cGL_Surface::Get_Path()
@@ -54,6 +54,19 @@ namespace TSC {
         cSaved_Texture* Get_Software_Texture(bool only_filename = 0);
         // Load a software texture
         void Load_Software_Texture(cSaved_Texture* soft_tex);
+        /* Use the texture of the given surface which is deleted
+         * also loads an evicted or not yet restored texture
+        */
+        void Take_Texture(cGL_Surface* surface);
+
+        /* Return the texture for drawing
+         * Marks it as used in the current frame and reloads it if evicted.
+        */
+        GLuint Get_Texture(void) const;
+        // Delete the texture until the next use which loads it again from the file
+        void Evict_Texture(void);
+        // Return the memory used by the texture in bytes
+        size_t Get_Texture_Memory(void) const;
 
         // Return the filename if created from a file, otherwise an
         // empty boost::filesystem::path instance.
@@ -79,6 +92,10 @@ namespace TSC {
         // texture dimension
         unsigned int m_tex_w;
         unsigned int m_tex_h;
+        // part of the drawing dimension covered by the texture
+        // below 1 if uploaded without the power of two padding
+        float m_content_w;
+        float m_content_h;
         // internal rotation
         float m_base_rot_x;
         float m_base_rot_y;
@@ -102,6 +119,10 @@ namespace TSC {
         bool m_managed;
         // if the image is tagged as obsolete
         bool m_obsolete;
+        // image manager frame the texture was last used for drawing
+        mutable uint32_t m_used_frame;
+        // if the texture was deleted to stay in the texture budget or is not yet restored
+        bool m_evicted;
 
         // editor tags
         std::string m_editor_tags;
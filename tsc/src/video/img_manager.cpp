@@ -20,6 +20,17 @@
 #include "../core/i18n.hpp"
 #include "../core/global_basic.hpp"
 #include "../core/property_helper.hpp"
+#include "../core/math/utilities.hpp"
+#include "../video/img_settings.hpp"
+#include "../core/game_core.hpp"
+#include "../core/sprite_manager.hpp"
+#include "../user/preferences.hpp"
+#include "../level/level.hpp"
+#include "../overworld/overworld.hpp"
+#include "../overworld/world_sprite_manager.hpp"
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <chrono>
 
 using namespace std;
 
@@ -53,10 +64,20 @@ cSaved_Texture::~cSaved_Texture(void)
 
 /* *** *** *** *** *** *** cImage_Manager *** *** *** *** *** *** *** *** *** *** *** */
 
+// frames between the texture budget checks
+static const uint32_t texture_budget_check_frames = 60;
+// frames a texture must be unused before it can be evicted
+static const uint32_t texture_evict_unused_frames = 600;
+// microseconds per frame to load pending textures in
+static const int64_t texture_restore_frame_time = 4000;
+
 cImage_Manager::cImage_Manager(void)
     : cObject_Manager<cGL_Surface>()
 {
     m_high_texture_id = 0;
+    m_frame = 0;
+    m_texture_memory = 0;
+    m_evicted_textures = 0;
 }
 
 cImage_Manager::~cImage_Manager(void)
@@ -72,6 +93,8 @@ void cImage_Manager::Add(cGL_Surface* obj)
 
     // it is now managed
     obj->m_managed = 1;
+    // not evicted before it had a chance to be drawn
+    obj->m_used_frame = m_frame;
 
     // Add and remember index where it was stored
     cObject_Manager<cGL_Surface>::Add(obj);
@@ -108,7 +131,7 @@ cGL_Surface* cImage_Manager::Copy(const fs::path& path)
 
 // Must be called on the loading screen, i.e. after Loading_Screen_Init() and
 // before Loading_Screen_Exit().
-void cImage_Manager::Grab_Textures(bool from_file /* = 0 */, bool draw_gui /* = 0 */)
+void cImage_Manager::Grab_Textures(bool draw_gui /* = 0 */)
 {
     // progress bar
     CEGUI::ProgressBar* progress_bar = NULL;
@@ -129,23 +152,35 @@ void cImage_Manager::Grab_Textures(bool from_file /* = 0 */, bool draw_gui /* =
         // get surface
         cGL_Surface* obj = (*itr);
 
+        // not loaded yet, it is loaded from file on its next use
+        if (!obj->m_image) {
+            continue;
+        }
+
         // skip surfaces with an already deleted texture
-        if (!glIsTexture(obj->m_image)) {
+        bool is_texture = 0;
+        pVideo->m_render_thread.Run([obj, &is_texture]() {
+            is_texture = glIsTexture(obj->m_image);
+        });
+
+        if (!is_texture) {
             continue;
         }
 
-        // get software texture and save it to software memory
-        m_saved_textures.push_back(obj->Get_Software_Texture(from_file));
+        // only read back textures which can not be loaded from file
+        m_saved_textures.push_back(obj->Get_Software_Texture(!obj->m_path.empty()));
         // delete hardware texture
-        if (glIsTexture(obj->m_image)) {
-            glDeleteTextures(1, &obj->m_image);
-        }
+        pVideo->m_render_thread.Run([obj]() {
+            if (glIsTexture(obj->m_image)) {
+                glDeleteTextures(1, &obj->m_image);
+            }
+        });
 
         // count files
         loaded_files++;
 
         // draw
-        if (draw_gui) {
+        if (draw_gui && (loaded_files % 50 == 0 || loaded_files == file_count)) {
             // update progress
             progress_bar->setProgress(static_cast<float>(loaded_files) / static_cast<float>(file_count));
 
@@ -154,7 +189,92 @@ void cImage_Manager::Grab_Textures(bool from_file /* = 0 */, bool draw_gui /* =
     }
 }
 
-void cImage_Manager::Restore_Textures(bool draw_gui /* = 0 */)
+/* Decodes the image files of the saved textures for Restore_Textures()
+ * Each item is decoded by one of the worker threads while the main thread
+ * uploads the finished ones in order.
+*/
+class cTexture_Restorer {
+public:
+    cTexture_Restorer(const Saved_Texture_List& textures)
+        : m_textures(textures), m_images(textures.size()), m_done(textures.size(), 0)
+    {
+        m_next = 0;
+    }
+
+    // Start the worker threads
+    void Start(void)
+    {
+        // leave a core for the main thread uploading the textures
+        unsigned int count = boost::thread::hardware_concurrency();
+        count = count > 1 ? std::min(count - 1, 4u) : 1;
+
+        for (unsigned int i = 0; i < count; i++) {
+            m_threads.add_thread(new boost::thread(&cTexture_Restorer::Worker, this));
+        }
+    }
+
+    // Wait for the image of the given item and take it
+    cVideo::cSoftware_Image Take(size_t num)
+    {
+        boost::unique_lock<boost::mutex> lock(m_mutex);
+
+        while (!m_done[num]) {
+            m_condition.wait(lock);
+        }
+
+        cVideo::cSoftware_Image image = m_images[num];
+        m_images[num] = cVideo::cSoftware_Image();
+        return image;
+    }
+
+    // Wait for the worker threads
+    void Join(void)
+    {
+        m_threads.join_all();
+    }
+private:
+    void Worker(void)
+    {
+        // settings parser of this thread
+        cImage_Settings_Parser settings_parser;
+
+        while (1) {
+            size_t num;
+
+            {
+                boost::lock_guard<boost::mutex> lock(m_mutex);
+
+                if (m_next >= m_textures.size()) {
+                    return;
+                }
+
+                num = m_next++;
+            }
+
+            cVideo::cSoftware_Image image = pVideo->Load_Image(m_textures[num]->m_base->m_path, 1, 0, &settings_parser);
+
+            {
+                boost::lock_guard<boost::mutex> lock(m_mutex);
+                m_images[num] = image;
+                m_done[num] = 1;
+            }
+
+            m_condition.notify_all();
+        }
+    }
+
+    const Saved_Texture_List& m_textures;
+    std::vector<cVideo::cSoftware_Image> m_images;
+    std::vector<char> m_done;
+    // next item to decode
+    size_t m_next;
+
+    boost::thread_group m_threads;
+    boost::mutex m_mutex;
+    boost::condition_variable m_condition;
+};
+
+void cImage_Manager::Restore_Textures(bool draw_gui /* = 0 */, const std::set<const cGL_Surface*>* priority /* = NULL */)
 {
     // progress bar
     CEGUI::ProgressBar* progress_bar = NULL;
@@ -170,21 +290,76 @@ void cImage_Manager::Restore_Textures(bool draw_gui /* = 0 */)
     unsigned int loaded_files = 0;
     unsigned int file_count = m_saved_textures.size();
 
-    // load back into hardware textures
+    Saved_Texture_List file_textures;
+
+    // load the software textures back into hardware textures
     for (Saved_Texture_List::iterator itr = m_saved_textures.begin(); itr != m_saved_textures.end(); ++itr) {
         // get saved texture
         cSaved_Texture* soft_tex = (*itr);
 
+        // loaded from file below
+        if (!soft_tex->m_pixels) {
+            file_textures.push_back(soft_tex);
+            continue;
+        }
+
         // load it
         soft_tex->m_base->Load_Software_Texture(soft_tex);
         // delete
         delete soft_tex;
 
+        loaded_files++;
+    }
+
+    m_saved_textures.clear();
+
+    /* only the given surfaces now so the next frame is not delayed
+     * the others are loaded on their first use or by Update() */
+    if (priority) {
+        Saved_Texture_List::iterator first_pending = std::stable_partition(file_textures.begin(), file_textures.end(), [priority](const cSaved_Texture* soft_tex) {
+            return priority->count(soft_tex->m_base) > 0;
+        });
+
+        for (Saved_Texture_List::iterator itr = first_pending; itr != file_textures.end(); ++itr) {
+            cGL_Surface* base = (*itr)->m_base;
+
+            // the texture was deleted with the old context
+            base->m_image = 0;
+            base->m_evicted = 1;
+            m_pending_textures.push_back(base);
+
+            delete *itr;
+        }
+
+        file_textures.erase(first_pending, file_textures.end());
+        file_count = loaded_files + file_textures.size();
+    }
+
+    cTexture_Restorer restorer(file_textures);
+    restorer.Start();
+
+    // upload in order while the workers decode the next ones
+    for (size_t i = 0; i < file_textures.size(); i++) {
+        cSaved_Texture* soft_tex = file_textures[i];
+        cGL_Surface* base = soft_tex->m_base;
+
+        cVideo::cSoftware_Image software_image = restorer.Take(i);
+        cGL_Surface* surface_copy = software_image.m_sf_image ? pVideo->Create_GL_Surface(software_image, base->m_path) : NULL;
+
+        if (surface_copy) {
+            base->Take_Texture(surface_copy);
+        }
+        else {
+            cerr << "Warning: cImage_Manager :: Restore_Textures " << path_to_utf8(base->m_path) << " loading failed" << endl;
+        }
+
+        delete soft_tex;
+
         // count files
         loaded_files++;
 
         // draw
-        if (draw_gui) {
+        if (draw_gui && (loaded_files % 50 == 0 || i + 1 == file_textures.size())) {
             // update progress
             progress_bar->setProgress(static_cast<float>(loaded_files) / static_cast<float>(file_count));
 
@@ -192,24 +367,36 @@ void cImage_Manager::Restore_Textures(bool draw_gui /* = 0 */)
         }
     }
 
-    m_saved_textures.clear();
+    restorer.Join();
 }
 
 void cImage_Manager::Delete_Image_Textures(void)
 {
-    for (GL_Surface_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
-        // get object
-        cGL_Surface* obj = (*itr);
-
-        if (obj->m_auto_del_img && glIsTexture(obj->m_image)) {
-            glDeleteTextures(1, &obj->m_image);
+    auto delete_textures = [this]() {
+        for (GL_Surface_List::iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+            // get object
+            cGL_Surface* obj = (*itr);
+
+            if (obj->m_auto_del_img && glIsTexture(obj->m_image)) {
+                glDeleteTextures(1, &obj->m_image);
+            }
         }
+    };
+
+    // the video is deleted first on exit
+    if (pVideo) {
+        pVideo->m_render_thread.Run(delete_textures);
+    }
+    else {
+        delete_textures();
     }
 }
 
 bool cImage_Manager::Delete(size_t array_num, bool delete_data)
 {
     if (array_num < objects.size()) {
+        m_pending_textures.erase(std::remove(m_pending_textures.begin(), m_pending_textures.end(), objects[array_num]), m_pending_textures.end());
+
         std::string filepath = path_to_utf8(objects[array_num]->m_path);
         objects.erase(objects.begin() + array_num);
         m_index_table.erase(filepath);
@@ -224,6 +411,8 @@ bool cImage_Manager::Delete(size_t array_num, bool delete_data)
 
 bool cImage_Manager::Delete(cGL_Surface* obj, bool delete_data)
 {
+    m_pending_textures.erase(std::remove(m_pending_textures.begin(), m_pending_textures.end(), obj), m_pending_textures.end());
+
     std::string filepath = path_to_utf8(obj->m_path);
     if (cObject_Manager::Delete(obj, delete_data)) {
         m_index_table.erase(filepath);
@@ -237,18 +426,180 @@ bool cImage_Manager::Delete(cGL_Surface* obj, bool delete_data)
 void cImage_Manager::Delete_Hardware_Textures(void)
 {
     // delete all hardware surfaces
-    for (GLuint i = 0; i < m_high_texture_id; i++) {
-        if (glIsTexture(i)) {
-            cout << "ImageManager : deleting texture " << i << endl;
-            glDeleteTextures(1, &i);
+    pVideo->m_render_thread.Run([this]() {
+        for (GLuint i = 0; i < m_high_texture_id; i++) {
+            if (glIsTexture(i)) {
+                cout << "ImageManager : deleting texture " << i << endl;
+                glDeleteTextures(1, &i);
+            }
         }
-    }
+    });
 
     m_high_texture_id = 0;
 }
 
+size_t cImage_Manager::Get_Texture_Memory(size_t* padded_memory /* = NULL */) const
+{
+    size_t memory = 0;
+    size_t padded = 0;
+    // surface copies share the texture
+    std::set<GLuint> counted;
+
+    for (GL_Surface_List::const_iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+        const cGL_Surface* obj = (*itr);
+
+        if (!obj->m_image || !counted.insert(obj->m_image).second) {
+            continue;
+        }
+
+        memory += obj->Get_Texture_Memory();
+        padded += Get_Power_of_2(obj->m_tex_w) * Get_Power_of_2(obj->m_tex_h) * 4;
+    }
+
+    if (padded_memory) {
+        *padded_memory = padded;
+    }
+
+    return memory;
+}
+
+void cImage_Manager::Update(void)
+{
+    m_frame++;
+
+    Restore_Pending_Textures();
+
+    if (m_frame % texture_budget_check_frames) {
+        return;
+    }
+
+    m_texture_memory = Get_Texture_Memory();
+
+    const size_t budget = Get_Texture_Budget();
+
+    if (!budget || m_texture_memory <= budget) {
+        return;
+    }
+
+    // evict a bit more to not check again at once
+    Evict_Textures(budget - (budget / 8));
+}
+
+size_t cImage_Manager::Get_Texture_Budget(void) const
+{
+    return static_cast<size_t>(pPreferences->m_video_texture_budget) * 1024 * 1024;
+}
+
+// Add the surfaces the sprite can show
+static void Add_Sprite_Surfaces(const cSprite* sprite, std::set<const cGL_Surface*>& surfaces)
+{
+    surfaces.insert(sprite->m_image);
+    surfaces.insert(sprite->m_start_image);
+
+    for (cSprite::Surface_List::const_iterator itr = sprite->m_images.begin(); itr != sprite->m_images.end(); ++itr) {
+        surfaces.insert(itr->m_image);
+    }
+}
+
+void cImage_Manager::Evict_Textures(size_t target)
+{
+    // used by the sprites of the active level and overworld even if asleep
+    std::set<const cGL_Surface*> used_surfaces;
+
+    if (pActive_Level) {
+        for (cSprite_List::const_iterator itr = pActive_Level->m_sprite_manager->objects.begin(); itr != pActive_Level->m_sprite_manager->objects.end(); ++itr) {
+            Add_Sprite_Surfaces(*itr, used_surfaces);
+        }
+    }
+
+    if (pActive_Overworld) {
+        for (cSprite_List::const_iterator itr = pActive_Overworld->m_sprite_manager->objects.begin(); itr != pActive_Overworld->m_sprite_manager->objects.end(); ++itr) {
+            Add_Sprite_Surfaces(*itr, used_surfaces);
+        }
+    }
+
+    if (pActive_Player) {
+        Add_Sprite_Surfaces(pActive_Player, used_surfaces);
+    }
+
+    // surfaces sharing a texture keep it
+    std::unordered_map<GLuint, unsigned int> texture_users;
+
+    for (GL_Surface_List::const_iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+        if ((*itr)->m_image) {
+            texture_users[(*itr)->m_image]++;
+        }
+    }
+
+    GL_Surface_List candidates;
+
+    for (GL_Surface_List::const_iterator itr = objects.begin(); itr != objects.end(); ++itr) {
+        cGL_Surface* obj = (*itr);
+
+        // only textures which can be loaded again from file
+        if (!obj->m_image || !obj->m_auto_del_img || obj->m_path.empty() || texture_users[obj->m_image] > 1) {
+            continue;
+        }
+
+        if (m_frame - obj->m_used_frame < texture_evict_unused_frames || used_surfaces.count(obj)) {
+            continue;
+        }
+
+        candidates.push_back(obj);
+    }
+
+    // least recently used first
+    std::sort(candidates.begin(), candidates.end(), [](const cGL_Surface* a, const cGL_Surface* b) {
+        return a->m_used_frame < b->m_used_frame;
+    });
+
+    for (GL_Surface_List::iterator itr = candidates.begin(); itr != candidates.end() && m_texture_memory > target; ++itr) {
+        cGL_Surface* obj = (*itr);
+
+        m_texture_memory -= obj->Get_Texture_Memory();
+        obj->Evict_Texture();
+        m_evicted_textures++;
+    }
+}
+
+void cImage_Manager::Restore_Pending_Textures(void)
+{
+    if (m_pending_textures.empty()) {
+        return;
+    }
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    // at least one each frame
+    while (!m_pending_textures.empty()) {
+        cGL_Surface* obj = m_pending_textures.back();
+        m_pending_textures.pop_back();
+
+        // already loaded by drawing it
+        if (!obj->m_evicted) {
+            continue;
+        }
+
+        cGL_Surface* surface_copy = pVideo->Load_GL_Surface(obj->m_path);
+
+        if (surface_copy) {
+            obj->Take_Texture(surface_copy);
+        }
+        else {
+            obj->m_evicted = 0;
+            cerr << "Warning: cImage_Manager :: Restore_Pending_Textures " << path_to_utf8(obj->m_path) << " loading failed" << endl;
+        }
+
+        if (std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count() >= texture_restore_frame_time) {
+            break;
+        }
+    }
+}
+
 void cImage_Manager::Delete_All(void)
 {
+    m_pending_textures.clear();
+
     // stops cGL_Surface destructor from checking if GL texture id still in use
     Delete_Image_Textures();
     cObject_Manager<cGL_Surface>::Delete_All();
@@ -85,17 +85,22 @@ namespace TSC {
             return Get_Pointer(path);
         }
 
-        /* Save hardware textures in software memory
-         * from_file: if set don't store in software memory but load again from file
+        /* Remember the hardware textures for restoring
+         * Textures loaded from a file are loaded again from it or the image cache.
+         * Only the other textures are read back into software memory.
          * draw_gui : if set use the loading screen gui for drawing
         */
-        void Grab_Textures(bool from_file = 0, bool draw_gui = 0);
+        void Grab_Textures(bool draw_gui = 0);
 
-        /* Load the saved software textures back into hardware textures or
-         * load textures from file if set
+        /* Load the saved software textures back into hardware textures and
+         * reload the other textures from file
+         * The files are decoded in parallel by worker threads.
          * draw_gui : if set use the loading screen gui for drawing
+         * priority : if set only these file textures, like the ones visible on screen,
+         *            are loaded now. The others are loaded on their first use or a
+         *            few each frame by Update().
         */
-        void Restore_Textures(bool draw_gui = 0);
+        void Restore_Textures(bool draw_gui = 0, const std::set<const cGL_Surface*>* priority = NULL);
 
         // Delete all surface textures, but keep object vector entries
         void Delete_Image_Textures(void);
@@ -106,15 +111,42 @@ namespace TSC {
         // Delete all Surfaces
         virtual void Delete_All(void);
 
+        /* Return the texture memory in bytes used by the managed surfaces
+         * padded_memory : set to the memory the textures would use with power of two padding
+        */
+        size_t Get_Texture_Memory(size_t* padded_memory = NULL) const;
+
+        /* Count a frame, restore pending textures and keep the texture memory in the budget
+         * Evicts the least recently used textures loaded from a file which are
+         * not used by a sprite of the active level or overworld. They are
+         * loaded again with the next drawing.
+        */
+        void Update(void);
+        // Return the texture memory budget in bytes or 0 if unlimited
+        size_t Get_Texture_Budget(void) const;
+
         virtual bool Delete(size_t array_num, bool delete_data = 1);
         virtual bool Delete(cGL_Surface* obj, bool delete_data = 1);
 
         // highest opengl texture id found
         GLuint m_high_texture_id;
+        // counted frames for the last use of the textures
+        uint32_t m_frame;
+        // texture memory at the last budget check
+        size_t m_texture_memory;
+        // textures evicted to stay in the budget
+        uint32_t m_evicted_textures;
 
     private:
+        // Evict textures until the memory is below the given target
+        void Evict_Textures(size_t target);
+        // Load pending file textures until the frame budget is used
+        void Restore_Pending_Textures(void);
+
         // saved textures for reloading
         Saved_Texture_List m_saved_textures;
+        // file textures not yet restored after a video mode change
+        GL_Surface_List m_pending_textures;
 
         std::unordered_map<std::string, size_t> m_index_table;
     };
@@ -117,7 +117,12 @@ cImageSet::Surface::~Surface(void)
 void cImageSet::Surface::Enter(void)
 {
     // set random time for this frame
-    m_time = m_info.m_time_min + rand() % (m_info.m_time_max - m_info.m_time_min + 1);
+    if (m_info.m_time_max > m_info.m_time_min) {
+        m_time = m_info.m_time_min + rand() % (m_info.m_time_max - m_info.m_time_min + 1);
+    }
+    else {
+        m_time = m_info.m_time_min;
+    }
 }
 
 int cImageSet::Surface::Leave(void)
@@ -387,6 +392,19 @@ void cImageSet::Set_Time_All(const uint32_t time, const bool default_time /* = 0
     }
 }
 
+bool cImageSet::Has_Random_Frames(void) const
+{
+    for (Surface_List::const_iterator itr = m_images.begin(); itr != m_images.end(); ++itr) {
+        const Surface& obj = (*itr);
+
+        if (obj.m_info.m_time_max > obj.m_info.m_time_min || !obj.m_info.m_branches.empty()) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
 /* static */
 cGL_Surface* cImageSet::Fetch_Single_Image(const fs::path& path, int idx /*= 0*/)
 {
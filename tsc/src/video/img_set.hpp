@@ -108,6 +108,10 @@ namespace TSC {
         cGL_Surface* Get_Image(const unsigned int num) const;
         // Clear the image list
         void Clear_Images(bool reset_image=false, bool reset_startimage=false);
+        /* Returns true if an image has a random time or branches
+         * the animation of those calls rand() and is not thread-safe
+        */
+        bool Has_Random_Frames(void) const;
 
         /* Set if the animation is enabled
          * default : disabled
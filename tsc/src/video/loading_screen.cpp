@@ -111,9 +111,7 @@ void TSC::Loading_Screen_Draw(void)
     pVideo->Draw_Rect(NULL, 0.00001f, &black);
 
     // Render
-    pRenderer->Render();
-    CEGUI::System::getSingleton().renderAllGUIContexts();
-    pVideo->mp_window->display();
+    pVideo->Render();
 }
 
 void TSC::Loading_Screen_Exit(void)
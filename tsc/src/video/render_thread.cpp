@@ -0,0 +1,207 @@
+/***************************************************************************
+ * render_thread.cpp  -  thread running all OpenGL calls
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../video/render_thread.hpp"
+#include <exception>
+
+using namespace std;
+
+namespace TSC {
+
+/* *** *** *** *** *** *** cRender_Thread *** *** *** *** *** *** *** *** *** *** *** */
+
+// set for the render thread
+static thread_local bool is_render_thread = 0;
+
+cRender_Thread::cRender_Thread(void)
+{
+    m_busy = 0;
+    m_quit = 0;
+    m_busy_time = 0;
+    m_wait_time = 0;
+    mp_window = NULL;
+    mp_main_context = NULL;
+}
+
+cRender_Thread::~cRender_Thread(void)
+{
+    Stop();
+}
+
+void cRender_Thread::Start(sf::RenderWindow* window)
+{
+    if (mp_window || !window) {
+        return;
+    }
+
+    // a context can only be active in one thread
+    window->setActive(false);
+    // activates itself for this thread
+    mp_main_context = new sf::Context();
+
+    mp_window = window;
+    m_quit = 0;
+    m_thread = boost::thread(&cRender_Thread::Worker, this);
+}
+
+void cRender_Thread::Stop(void)
+{
+    if (!mp_window) {
+        return;
+    }
+
+    {
+        boost::lock_guard<boost::mutex> lock(m_mutex);
+        m_quit = 1;
+    }
+
+    m_command_condition.notify_all();
+    m_thread.join();
+
+    delete mp_main_context;
+    mp_main_context = NULL;
+
+    mp_window->setActive(true);
+    mp_window = NULL;
+}
+
+bool cRender_Thread::Is_Render_Thread(void)
+{
+    return is_render_thread;
+}
+
+void cRender_Thread::Post(const Command& command)
+{
+    if (!mp_window || is_render_thread) {
+        command();
+        return;
+    }
+
+    {
+        boost::lock_guard<boost::mutex> lock(m_mutex);
+        m_commands.push_back(command);
+    }
+
+    m_command_condition.notify_one();
+}
+
+void cRender_Thread::Run(const Command& command)
+{
+    if (!mp_window || is_render_thread) {
+        command();
+        return;
+    }
+
+    // pass errors to the caller
+    std::exception_ptr error;
+
+    Post([&command, &error]() {
+        try {
+            command();
+        }
+        catch (...) {
+            error = std::current_exception();
+        }
+    });
+    Finish();
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+void cRender_Thread::Finish(void)
+{
+    if (!mp_window || is_render_thread) {
+        return;
+    }
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    {
+        boost::unique_lock<boost::mutex> lock(m_mutex);
+
+        while (m_busy || !m_commands.empty()) {
+            m_idle_condition.wait(lock);
+        }
+    }
+
+    m_wait_time += static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+}
+
+uint32_t cRender_Thread::Take_Busy_Time(void)
+{
+    boost::lock_guard<boost::mutex> lock(m_mutex);
+    uint32_t busy_time = m_busy_time;
+    m_busy_time = 0;
+    return busy_time;
+}
+
+uint32_t cRender_Thread::Take_Wait_Time(void)
+{
+    uint32_t wait_time = m_wait_time;
+    m_wait_time = 0;
+    return wait_time;
+}
+
+void cRender_Thread::Worker(void)
+{
+    is_render_thread = 1;
+    mp_window->setActive(true);
+
+    boost::unique_lock<boost::mutex> lock(m_mutex);
+
+    while (1) {
+        while (!m_quit && m_commands.empty()) {
+            m_command_condition.wait(lock);
+        }
+
+        // run the remaining commands before quitting
+        if (m_commands.empty()) {
+            break;
+        }
+
+        Command command = m_commands.front();
+        m_commands.pop_front();
+        m_busy = 1;
+        lock.unlock();
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+        try {
+            command();
+        }
+        catch (const std::exception& e) {
+            cerr << "Error : Render thread command failed : " << e.what() << endl;
+        }
+
+        const uint32_t elapsed = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+
+        lock.lock();
+        m_busy = 0;
+        m_busy_time += elapsed;
+
+        if (m_commands.empty()) {
+            m_idle_condition.notify_all();
+        }
+    }
+
+    lock.unlock();
+    mp_window->setActive(false);
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
@@ -0,0 +1,101 @@
+/***************************************************************************
+ * render_thread.hpp
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_RENDER_THREAD_HPP
+#define TSC_RENDER_THREAD_HPP
+
+#include "../core/global_basic.hpp"
+#include <deque>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+
+namespace TSC {
+
+    /* *** *** *** *** *** cRender_Thread *** *** *** *** *** *** *** *** *** *** *** *** */
+
+    /* Thread owning the OpenGL context of the window while it is running
+     * All OpenGL calls of the game are passed to it as commands which are run
+     * in the order they were given. Post() returns at once and Run() waits
+     * until the command is done. While it is not running or if called from
+     * the render thread itself the commands are run directly.
+     * The main thread gets a context of its own sharing the textures with the
+     * window context. It is only used by libraries creating textures outside
+     * of rendering like CEGUI loading fonts and imagesets.
+    */
+    class cRender_Thread {
+    public:
+        typedef std::function<void()> Command;
+
+        cRender_Thread(void);
+        ~cRender_Thread(void);
+
+        /* Start the thread and move the context of the window to it
+         * must be called from the thread the window was created in
+        */
+        void Start(sf::RenderWindow* window);
+        /* Run all remaining commands, stop the thread and make the
+         * window context current for the calling thread again
+        */
+        void Stop(void);
+
+        // returns true if started
+        inline bool Is_Running(void) const
+        {
+            return mp_window != NULL;
+        };
+        // returns true if called from the render thread
+        static bool Is_Render_Thread(void);
+
+        // Add a command to run after the already added ones
+        void Post(const Command& command);
+        // Add a command and wait until it is done
+        void Run(const Command& command);
+        // Wait until all added commands are done
+        void Finish(void);
+
+        // Return the microseconds the render thread was busy since the last call
+        uint32_t Take_Busy_Time(void);
+        // Return the microseconds the caller waited for the render thread since the last call
+        uint32_t Take_Wait_Time(void);
+    private:
+        // thread function
+        void Worker(void);
+
+        boost::thread m_thread;
+        boost::mutex m_mutex;
+        // the render thread waits for commands
+        boost::condition_variable m_command_condition;
+        // Finish() waits for the last command
+        boost::condition_variable m_idle_condition;
+        std::deque<Command> m_commands;
+        // a command is running
+        bool m_busy;
+        bool m_quit;
+        // microseconds spent running commands
+        uint32_t m_busy_time;
+        // microseconds spent in Finish()
+        uint32_t m_wait_time;
+
+        // window of the moved context or NULL if not running
+        sf::RenderWindow* mp_window;
+        // context of the thread which started the render thread
+        sf::Context* mp_main_context;
+    };
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
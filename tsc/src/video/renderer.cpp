@@ -29,6 +29,9 @@ namespace TSC {
 
 const float doubled_pi = static_cast<float>(M_PI * 2.0f);
 static GLuint last_bind_texture = 0;
+// camera position of the rendered queue
+static float render_camera_x = 0.0f;
+static float render_camera_y = 0.0f;
 
 /* *** *** *** *** *** *** cRender_Request *** *** *** *** *** *** *** *** *** *** *** */
 
@@ -191,7 +194,7 @@ void cLine_Request::Draw(void)
 
     // set camera position
     if (!m_no_camera) {
-        glTranslatef(-pActive_Camera->m_x, -pActive_Camera->m_y, m_pos_z);
+        glTranslatef(-render_camera_x, -render_camera_y, m_pos_z);
     }
     else {
         // only z position
@@ -278,8 +281,8 @@ void cRect_Request::Draw(void)
 
     // set camera position
     if (!m_no_camera) {
-        final_pos_x -= pActive_Camera->m_x;
-        final_pos_y -= pActive_Camera->m_y;
+        final_pos_x -= render_camera_x;
+        final_pos_y -= render_camera_y;
     }
 
     glTranslatef(final_pos_x, final_pos_y, m_pos_z);
@@ -367,7 +370,7 @@ void cGradient_Request::Draw(void)
 
     // set camera position
     if (!m_no_camera) {
-        glTranslatef(m_rect.m_x - pActive_Camera->m_x, m_rect.m_y - pActive_Camera->m_y, m_pos_z);
+        glTranslatef(m_rect.m_x - render_camera_x, m_rect.m_y - render_camera_y, m_pos_z);
     }
     // ignore camera position
     else {
@@ -433,7 +436,7 @@ void cCircle_Request::Draw(void)
 
     // set camera position
     if (!m_no_camera) {
-        glTranslatef(m_pos.m_x - pActive_Camera->m_x, m_pos.m_y - pActive_Camera->m_y, m_pos_z);
+        glTranslatef(m_pos.m_x - render_camera_x, m_pos.m_y - render_camera_y, m_pos_z);
     }
     // ignore camera position
     else {
@@ -514,6 +517,8 @@ cSurface_Request::cSurface_Request(void)
 
     m_w = 0.0f;
     m_h = 0.0f;
+    m_content_w = 1.0f;
+    m_content_h = 1.0f;
 
     m_scale_x = 1.0f;
     m_scale_y = 1.0f;
@@ -586,8 +591,8 @@ void cSurface_Request::Draw(void)
 
     // set camera position
     if (!m_no_camera) {
-        final_pos_x -= pActive_Camera->m_x;
-        final_pos_y -= pActive_Camera->m_y;
+        final_pos_x -= render_camera_x;
+        final_pos_y -= render_camera_y;
     }
 
     glTranslatef(final_pos_x, final_pos_y, m_pos_z);
@@ -614,6 +619,10 @@ void cSurface_Request::Draw(void)
         last_bind_texture = m_texture_id;
     }
 
+    // right and bottom edge of the texture
+    const float right = -half_w + (m_w * m_content_w);
+    const float bottom = -half_h + (m_h * m_content_h);
+
     /* vertex arrays should not be used to draw simple primitives as it
      * does have no positive performance gain
     */
@@ -624,13 +633,13 @@ void cSurface_Request::Draw(void)
     glVertex2f(-half_w, -half_h);
     // top right
     glTexCoord2f(1.0f, 0.0f);
-    glVertex2f(half_w, -half_h);
+    glVertex2f(right, -half_h);
     // bottom right
     glTexCoord2f(1.0f, 1.0f);
-    glVertex2f(half_w, half_h);
+    glVertex2f(right, bottom);
     // bottom left
     glTexCoord2f(0.0f, 1.0f);
-    glVertex2f(-half_w, half_h);
+    glVertex2f(-half_w, bottom);
     glEnd();
 
     // clear color
@@ -645,11 +654,117 @@ void cSurface_Request::Draw(void)
     Render_Basic_Clear();
 }
 
+/* *** *** *** *** *** *** cSurface_Batch_Request *** *** *** *** *** *** *** *** *** *** *** */
+
+cSurface_Batch_Request::cSurface_Batch_Request(void)
+    : cRender_Request_Advanced()
+{
+    m_type = REND_SURFACE_BATCH;
+    m_texture_id = 0;
+
+    m_w = 0.0f;
+    m_h = 0.0f;
+    m_content_w = 1.0f;
+    m_content_h = 1.0f;
+}
+
+cSurface_Batch_Request::~cSurface_Batch_Request(void)
+{
+
+}
+
+void cSurface_Batch_Request::Draw(void)
+{
+    const std::vector<cSurface_Batch_Item>& items = m_shared_items ? *m_shared_items : m_items;
+
+    if (items.empty()) {
+        return;
+    }
+
+    Render_Basic();
+
+    if (!glIsEnabled(GL_TEXTURE_2D)) {
+        glEnable(GL_TEXTURE_2D);
+    }
+
+    // only bind if not the same texture
+    if (last_bind_texture != m_texture_id) {
+        glBindTexture(GL_TEXTURE_2D, m_texture_id);
+        last_bind_texture = m_texture_id;
+    }
+
+    const float batch_deg_to_rad = static_cast<float>(M_PI / 180.0f);
+    // get half the size
+    const float half_w = m_w / 2;
+    const float half_h = m_h / 2;
+    // right and bottom edge of the texture
+    const float right = -half_w + (m_w * m_content_w);
+    const float bottom = -half_h + (m_h * m_content_h);
+    // quad corners and texture coordinates
+    const float corner_x[4] = { -half_w, right, right, -half_w };
+    const float corner_y[4] = { -half_h, -half_h, bottom, bottom };
+    const float tex_x[4] = { 0.0f, 1.0f, 1.0f, 0.0f };
+    const float tex_y[4] = { 0.0f, 0.0f, 1.0f, 1.0f };
+
+    glBegin(GL_QUADS);
+
+    for (std::vector<cSurface_Batch_Item>::const_iterator itr = items.begin(); itr != items.end(); ++itr) {
+        const cSurface_Batch_Item& item = (*itr);
+
+        // position
+        float final_pos_x = item.m_pos_x + (half_w * item.m_scale_x);
+        float final_pos_y = item.m_pos_y + (half_h * item.m_scale_y);
+
+        // set camera position
+        if (!m_no_camera) {
+            final_pos_x -= render_camera_x;
+            final_pos_y -= render_camera_y;
+        }
+
+        // same order as glRotatef x, y and z in Render_Advanced
+        const float rad_x = (m_rot_x + item.m_rot_x) * batch_deg_to_rad;
+        const float rad_y = (m_rot_y + item.m_rot_y) * batch_deg_to_rad;
+        const float rad_z = (m_rot_z + item.m_rot_z) * batch_deg_to_rad;
+        const float cos_x = cos(rad_x);
+        const float sin_x = sin(rad_x);
+        const float cos_y = cos(rad_y);
+        const float sin_y = sin(rad_y);
+        const float cos_z = cos(rad_z);
+        const float sin_z = sin(rad_z);
+
+        glColor4ub(item.m_color.red, item.m_color.green, item.m_color.blue, item.m_color.alpha);
+
+        for (unsigned int i = 0; i < 4; i++) {
+            // z rotation
+            float x = (corner_x[i] * cos_z) - (corner_y[i] * sin_z);
+            float y = (corner_x[i] * sin_z) + (corner_y[i] * cos_z);
+            // y rotation
+            float z = -x * sin_y;
+            x = x * cos_y;
+            // x rotation
+            const float rot_y = (y * cos_x) - (z * sin_x);
+            z = (y * sin_x) + (z * cos_x);
+
+            glTexCoord2f(tex_x[i], tex_y[i]);
+            glVertex3f(final_pos_x + (x * item.m_scale_x), final_pos_y + (rot_y * item.m_scale_y), item.m_pos_z + z);
+        }
+    }
+
+    glEnd();
+
+    // clear color
+    glColor4f(1.0f, 1.0f, 1.0f, 1.0f);
+
+    Render_Basic_Clear();
+}
+
 /* *** *** *** *** *** *** cRenderQueue *** *** *** *** *** *** *** *** *** *** *** */
 
 cRenderQueue::cRenderQueue(unsigned int reserve_items)
 {
     m_render_data.reserve(reserve_items);
+    m_camera_x = 0.0f;
+    m_camera_y = 0.0f;
 }
 
 cRenderQueue::~cRenderQueue(void)
@@ -674,15 +789,29 @@ void cRenderQueue::Add(cRender_Request* obj)
     }
 }
 
+void cRenderQueue::Sort(void)
+{
+    std::sort(m_render_data.begin(), m_render_data.end(), zpos_sort());
+}
+
+void cRenderQueue::Set_Camera(float x, float y)
+{
+    m_camera_x = x;
+    m_camera_y = y;
+}
+
 /**
  * Executes all render requests collected via Add().
  */
 void cRenderQueue::Render(bool clear /* = 1 */)
 {
     // z position sort
-    std::sort(m_render_data.begin(), m_render_data.end(), zpos_sort());
+    Sort();
     // reset last texture
     last_bind_texture = 0;
+    // camera position
+    render_camera_x = m_camera_x;
+    render_camera_y = m_camera_y;
 
     for (RenderList::iterator itr = m_render_data.begin(); itr != m_render_data.end(); ++itr) {
         cRender_Request* obj = (*itr);
@@ -20,6 +20,7 @@
 #include "../video/video.hpp"
 #include "../core/math/line.hpp"
 #include "../core/math/rect.hpp"
+#include <memory>
 
 namespace TSC {
 
@@ -33,7 +34,8 @@ namespace TSC {
         REND_SURFACE = 4,
         REND_TEXT = 5,
         REND_LINE = 6,
-        REND_CIRCLE = 7
+        REND_CIRCLE = 7,
+        REND_SURFACE_BATCH = 8
     };
 
     /* *** *** *** *** *** *** cRender_Request *** *** *** *** *** *** *** *** *** *** *** */
@@ -212,6 +214,9 @@ namespace TSC {
         // size
         float m_w;
         float m_h;
+        // part of the size covered by the texture
+        float m_content_w;
+        float m_content_h;
 
         // color
         Color m_color;
@@ -220,6 +225,52 @@ namespace TSC {
         bool m_delete_texture;
     };
 
+    /* *** *** *** *** *** *** cSurface_Batch_Request *** *** *** *** *** *** *** *** *** *** *** */
+
+    // One quad of a surface batch
+    struct cSurface_Batch_Item {
+        // position
+        float m_pos_x;
+        float m_pos_y;
+        float m_pos_z;
+        // scale
+        float m_scale_x;
+        float m_scale_y;
+        // rotation
+        float m_rot_x;
+        float m_rot_y;
+        float m_rot_z;
+        // color
+        Color m_color;
+    };
+
+    /* Draws many quads of the same texture, size and blending in one request
+     * Each item is transformed like a cSurface_Request on the CPU so the whole
+     * batch needs only one texture bind and one glBegin/glEnd block.
+    */
+    class cSurface_Batch_Request : public cRender_Request_Advanced {
+    public:
+        cSurface_Batch_Request(void);
+        virtual ~cSurface_Batch_Request(void);
+
+        // Draw
+        virtual void Draw(void);
+
+        // texture id
+        GLuint m_texture_id;
+        // size
+        float m_w;
+        float m_h;
+        // part of the size covered by the texture
+        float m_content_w;
+        float m_content_h;
+
+        // quads
+        std::vector<cSurface_Batch_Item> m_items;
+        // prebuilt quads drawn instead of m_items if set
+        std::shared_ptr<const std::vector<cSurface_Batch_Item> > m_shared_items;
+    };
+
     /* *** *** *** *** *** *** cRenderQueue *** *** *** *** *** *** *** *** *** *** *** */
 
     class cRenderQueue {
@@ -231,6 +282,15 @@ namespace TSC {
         */
         void Add(cRender_Request* obj);
 
+        // Sort the render data by z position
+        void Sort(void);
+
+        /* Set the camera position subtracted from the requests
+         * must be set before the requests are rendered as the render thread
+         * may not read the camera while the next frame is updated
+        */
+        void Set_Camera(float x, float y);
+
         /* Render current data
          * clear: if set clear the finished data after rendering
         */
@@ -249,6 +309,9 @@ namespace TSC {
 
         // render data array
         RenderList m_render_data;
+        // camera position of the render data
+        float m_camera_x;
+        float m_camera_y;
 
         // Z position sort
         struct zpos_sort {
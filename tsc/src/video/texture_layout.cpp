@@ -0,0 +1,114 @@
+/***************************************************************************
+ * texture_layout.cpp  -  size calculations for uploading images as textures
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../video/texture_layout.hpp"
+#include "../core/math/utilities.hpp"
+
+using namespace std;
+
+namespace TSC {
+
+/* *** *** *** *** *** *** *** cTexture_Layout *** *** *** *** *** *** *** *** *** *** */
+
+cTexture_Layout::cTexture_Layout(void)
+{
+    m_width = 0;
+    m_height = 0;
+    m_texture_width = 0;
+    m_texture_height = 0;
+    m_reduce_x = 1;
+    m_reduce_y = 1;
+    m_pad = 0;
+    m_content_w = 1.0f;
+    m_content_h = 1.0f;
+}
+
+cTexture_Layout Get_Texture_Layout(unsigned int image_width, unsigned int image_height, bool npot, unsigned int force_width, unsigned int force_height, int max_texture_size)
+{
+    cTexture_Layout layout;
+
+    // power of two size
+    const unsigned int pot_width = Get_Power_of_2(image_width);
+    const unsigned int pot_height = Get_Power_of_2(image_height);
+
+    layout.m_width = pot_width;
+    layout.m_height = pot_height;
+
+    // forced size is set
+    if (force_width > 0 && force_height > 0) {
+        layout.m_width = Get_Power_of_2(force_width);
+        layout.m_height = Get_Power_of_2(force_height);
+    }
+
+    // texture size of the padded image
+    int texture_width = layout.m_width;
+    int texture_height = layout.m_height;
+    // check if the image size is greater than the maximum texture size
+    Apply_Max_Texture_Size(texture_width, texture_height, max_texture_size);
+
+    layout.m_reduce_x = texture_width > 0 ? pot_width / texture_width : 0;
+    layout.m_reduce_y = texture_height > 0 ? pot_height / texture_height : 0;
+
+    // already a power of two size or padding needed
+    if (!npot || (pot_width == image_width && pot_height == image_height)) {
+        layout.m_pad = pot_width != image_width || pot_height != image_height;
+        layout.m_texture_width = texture_width;
+        layout.m_texture_height = texture_height;
+        return layout;
+    }
+
+    // downscale like the padded image would be
+    layout.m_reduce_x = max(layout.m_reduce_x, 1u);
+    layout.m_reduce_y = max(layout.m_reduce_y, 1u);
+    layout.m_texture_width = max(image_width / layout.m_reduce_x, 1u);
+    layout.m_texture_height = max(image_height / layout.m_reduce_y, 1u);
+    // the padding area is left out
+    layout.m_content_w = static_cast<float>(image_width) / static_cast<float>(pot_width);
+    layout.m_content_h = static_cast<float>(image_height) / static_cast<float>(pot_height);
+
+    return layout;
+}
+
+void Apply_Max_Texture_Size(int& width, int& height, int max_texture_size)
+{
+    if (width > max_texture_size) {
+        // change height to keep aspect ratio
+        int scale_down = width / max_texture_size;
+
+        if (scale_down < 1) {
+            debug_print("Warning : image height scale down %d is invalid\n", scale_down);
+            scale_down = 1;
+        }
+
+        height = height / scale_down;
+        width = max_texture_size;
+    }
+    if (height > max_texture_size) {
+        // change width to keep aspect ratio
+        int scale_down = height / max_texture_size;
+
+        if (scale_down < 1) {
+            debug_print("Warning : image width scale down %d is invalid\n", scale_down);
+            scale_down = 1;
+        }
+
+        width = width / scale_down;
+        height = max_texture_size;
+    }
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
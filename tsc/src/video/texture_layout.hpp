@@ -0,0 +1,67 @@
+/***************************************************************************
+ * texture_layout.hpp  -  size calculations for uploading images as textures
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_TEXTURE_LAYOUT_HPP
+#define TSC_TEXTURE_LAYOUT_HPP
+
+#include "../core/global_basic.hpp"
+
+namespace TSC {
+
+    /* *** *** *** *** *** *** *** cTexture_Layout *** *** *** *** *** *** *** *** *** *** */
+
+    /* How an image is uploaded and drawn
+     * Images are always drawn with the size of their power of two padded
+     * version, as image settings and collision sizes are based on it. If the
+     * context supports non-power-of-two textures the image is uploaded
+     * without the transparent padding and only covers a part of the drawn
+     * size.
+    */
+    class cTexture_Layout {
+    public:
+        cTexture_Layout(void);
+
+        // drawing size
+        unsigned int m_width;
+        unsigned int m_height;
+        // uploaded texture size
+        unsigned int m_texture_width;
+        unsigned int m_texture_height;
+        // downscale block size of the (padded) image, 1 if not downscaled
+        unsigned int m_reduce_x;
+        unsigned int m_reduce_y;
+        // if the image needs to be padded to a power of two size before uploading
+        bool m_pad;
+        // part of the drawing size covered by the texture
+        float m_content_w;
+        float m_content_h;
+    };
+
+    /* Calculate the texture layout of an image
+     * npot : if non-power-of-two textures are supported
+     * force_width/height : drawing size to use if both are set
+     * max_texture_size : maximum texture size of the context
+     * Doesn't use OpenGL.
+    */
+    cTexture_Layout Get_Texture_Layout(unsigned int image_width, unsigned int image_height, bool npot, unsigned int force_width, unsigned int force_height, int max_texture_size);
+
+    // scale the size down if the width or height is bigger than the maximum texture size
+    void Apply_Max_Texture_Size(int& width, int& height, int max_texture_size);
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
@@ -32,6 +32,12 @@
 #include "../core/filesystem/resource_manager.hpp"
 #include "../core/filesystem/relative.hpp"
 #include "../gui/hud.hpp"
+#include "../level/level_manager.hpp"
+#include "../level/level_preloader.hpp"
+#include "../video/texture_layout.hpp"
+#include "../level/level.hpp"
+#include "../overworld/overworld.hpp"
+#include "../core/sprite_manager.hpp"
 #include "video.hpp"
 #include <CEGUI/XMLParserModules/Expat/XMLParserModule.h>
 using namespace std;
@@ -46,6 +52,7 @@ cVideo::cVideo(void)
 {
     mp_window = new sf::RenderWindow();
     m_opengl_version = 0;
+    m_npot_textures = 0;
 
     m_double_buffer = 0;
 
@@ -64,7 +71,10 @@ cVideo::cVideo(void)
 #ifdef __unix__
     glx_context = NULL;
 #endif
-    m_render_thread = boost::thread();
+    m_clear_color[0] = 0.0f;
+    m_clear_color[1] = 0.0f;
+    m_clear_color[2] = 0.0f;
+    m_clear_color[3] = 1.0f;
 
     mp_cegui_renderer = NULL;
     mp_default_tooltip = NULL;
@@ -74,6 +84,9 @@ cVideo::cVideo(void)
 
 cVideo::~cVideo(void)
 {
+    // get the context back
+    m_render_thread.Stop();
+
     if (mp_default_tooltip) {
         CEGUI::WindowManager::getSingleton().destroyWindow(mp_default_tooltip);
         CEGUI::System::getSingleton().getDefaultGUIContext().setDefaultTooltipObject(0);
@@ -101,8 +114,16 @@ void cVideo::Init_CEGUI(void)
     std::string utf8_logpath = path_to_utf8(pResource_Manager->Get_User_CEGUI_Logfile());
     debug_print("CEGUI log file is at '%s'.\n", utf8_logpath.c_str());
 
-    // create CEGUI renderer and system objects
-    mp_cegui_renderer = &CEGUI::OpenGLRenderer::create();
+    /* create CEGUI renderer and system objects
+     * render targets are framebuffer objects which can't be shared between contexts
+     * and CEGUI creates them in the main thread
+    */
+    if (pPreferences->m_video_render_thread) {
+        mp_cegui_renderer = &CEGUI::OpenGLRenderer::create(CEGUI::OpenGLRenderer::TTT_NONE);
+    }
+    else {
+        mp_cegui_renderer = &CEGUI::OpenGLRenderer::create();
+    }
 #ifdef CEGUI_USE_EXPAT
     mp_cegui_xmlparser = new CEGUI::ExpatParser();
 #else
@@ -164,9 +185,44 @@ void cVideo::Init_CEGUI(void)
     gui_context.setDefaultTooltipObject(mp_default_tooltip);
 }
 
+/* Get the images of the sprites visible with the active camera
+ * Only these are restored before the next frame after a video mode change.
+*/
+static void Get_Visible_Surfaces(std::set<const cGL_Surface*>& surfaces)
+{
+    cSprite_Manager* sprite_manager = NULL;
+
+    if (Game_Mode == MODE_LEVEL && pActive_Level) {
+        sprite_manager = pActive_Level->m_sprite_manager;
+    }
+    else if (Game_Mode == MODE_OVERWORLD && pActive_Overworld) {
+        sprite_manager = pActive_Overworld->m_sprite_manager;
+    }
+
+    if (sprite_manager) {
+        for (cSprite_List::iterator itr = sprite_manager->objects.begin(); itr != sprite_manager->objects.end(); ++itr) {
+            cSprite* obj = (*itr);
+
+            if (obj->m_auto_destroy || !obj->Is_Visible_On_Screen()) {
+                continue;
+            }
+
+            surfaces.insert(obj->m_image);
+            surfaces.insert(obj->m_start_image);
+        }
+    }
+
+    if (pActive_Player) {
+        surfaces.insert(pActive_Player->m_image);
+    }
+
+    surfaces.erase(NULL);
+}
+
 void cVideo::Init_Video(bool reload_textures_from_file /* = false */, bool use_preferences /* = true */)
 {
-    Render_Finish();
+    // the window is recreated
+    m_render_thread.Stop();
 
     sf::VideoMode videomode(800, 600, 16); // defaults
     sf::VideoMode desktopmode(sf::VideoMode::getDesktopMode());
@@ -220,7 +276,7 @@ void cVideo::Init_Video(bool reload_textures_from_file /* = false */, bool use_p
         Loading_Screen_Init();
 
         // save textures
-        pImage_Manager->Grab_Textures(reload_textures_from_file, 1);
+        pImage_Manager->Grab_Textures(1);
         mp_cegui_renderer->grabTextures();
         pImage_Manager->Delete_Hardware_Textures();
 
@@ -265,8 +321,10 @@ void cVideo::Init_Video(bool reload_textures_from_file /* = false */, bool use_p
             Init_Image_Cache(0);
         }
 
-        // restore textures
-        pImage_Manager->Restore_Textures(1);
+        // restore the visible textures, the others are loaded over the next frames
+        std::set<const cGL_Surface*> visible_surfaces;
+        Get_Visible_Surfaces(visible_surfaces);
+        pImage_Manager->Restore_Textures(1, &visible_surfaces);
 
         // Tell the HUD about the size change so it can adapt
         gp_hud->Screen_Size_Changed();
@@ -282,6 +340,10 @@ void cVideo::Init_Video(bool reload_textures_from_file /* = false */, bool use_p
 
         m_opengl_version = string_to_float(version_str);
 
+        // non-power-of-two textures are core since OpenGL 2.0
+        const char* extensions = reinterpret_cast<const char*>(glGetString(GL_EXTENSIONS));
+        m_npot_textures = m_opengl_version >= 2.0f || (extensions && strstr(extensions, "GL_ARB_texture_non_power_of_two"));
+
         // if below optimal version
         if (m_opengl_version < 1.4f) {
             if (m_opengl_version >= 1.3f) {
@@ -311,6 +373,10 @@ void cVideo::Init_Video(bool reload_textures_from_file /* = false */, bool use_p
 
         m_initialised = 1;
     }
+
+    if (pPreferences->m_video_render_thread) {
+        m_render_thread.Start(mp_window);
+    }
 }
 
 void cVideo::Init_OpenGL(void)
@@ -334,7 +400,7 @@ void cVideo::Init_OpenGL(void)
     glShadeModel(GL_SMOOTH);
 
     // set clear color to black
-    glClearColor(0, 0, 0, 1);
+    Set_Clear_Color(0, 0, 0, 1);
 
     // Z-Buffer
     glEnable(GL_DEPTH_TEST);
@@ -370,58 +436,58 @@ void cVideo::Init_OpenGL(void)
 
 void cVideo::Init_Geometry(void)
 {
-    Render_Finish();
-
-    // Geometry Anti-Aliasing
-    if (m_geometry_quality > 0.5f) {
-        // Point
-        glEnable(GL_POINT_SMOOTH);
-        glHint(GL_POINT_SMOOTH_HINT, GL_NICEST);
-        // Line
-        glEnable(GL_LINE_SMOOTH);
-        glHint(GL_LINE_SMOOTH_HINT, GL_NICEST);
-        // Polygon - does not display correctly with open source ATi drivers ( 18.2.2008 )
-        //glEnable( GL_POLYGON_SMOOTH );
-        // Geforce 4 440 MX hangs if enabled
-        //glHint( GL_POLYGON_SMOOTH_HINT, GL_NICEST );
-    }
-    else {
-        // Point
-        glEnable(GL_POINT_SMOOTH);
-        glHint(GL_POINT_SMOOTH_HINT, GL_FASTEST);
-        // Line
-        glEnable(GL_LINE_SMOOTH);
-        glHint(GL_LINE_SMOOTH_HINT, GL_FASTEST);
-    }
+    m_render_thread.Run([this]() {
+        // Geometry Anti-Aliasing
+        if (m_geometry_quality > 0.5f) {
+            // Point
+            glEnable(GL_POINT_SMOOTH);
+            glHint(GL_POINT_SMOOTH_HINT, GL_NICEST);
+            // Line
+            glEnable(GL_LINE_SMOOTH);
+            glHint(GL_LINE_SMOOTH_HINT, GL_NICEST);
+            // Polygon - does not display correctly with open source ATi drivers ( 18.2.2008 )
+            //glEnable( GL_POLYGON_SMOOTH );
+            // Geforce 4 440 MX hangs if enabled
+            //glHint( GL_POLYGON_SMOOTH_HINT, GL_NICEST );
+        }
+        else {
+            // Point
+            glEnable(GL_POINT_SMOOTH);
+            glHint(GL_POINT_SMOOTH_HINT, GL_FASTEST);
+            // Line
+            glEnable(GL_LINE_SMOOTH);
+            glHint(GL_LINE_SMOOTH_HINT, GL_FASTEST);
+        }
 
-    /* Perspective Correction
-     * The quality of color, texture coordinate, and fog coordinate interpolation
-    */
-    if (m_geometry_quality > 0.25f) {
-        // high quality
-        glHint(GL_PERSPECTIVE_CORRECTION_HINT, GL_NICEST);
-    }
-    else {
-        // low quality
-        glHint(GL_PERSPECTIVE_CORRECTION_HINT, GL_FASTEST);
-    }
+        /* Perspective Correction
+         * The quality of color, texture coordinate, and fog coordinate interpolation
+        */
+        if (m_geometry_quality > 0.25f) {
+            // high quality
+            glHint(GL_PERSPECTIVE_CORRECTION_HINT, GL_NICEST);
+        }
+        else {
+            // low quality
+            glHint(GL_PERSPECTIVE_CORRECTION_HINT, GL_FASTEST);
+        }
+    });
 }
 
 void cVideo::Init_Texture_Detail(void)
 {
-    Render_Finish();
-
-    /* filter quality of generated mipmap images
-     * only available if OpenGL version is 1.4 or greater
-    */
-    if (m_opengl_version >= 1.4f) {
-        if (m_texture_quality > 0.2f) {
-            glHint(GL_GENERATE_MIPMAP_HINT, GL_NICEST);
-        }
-        else {
-            glHint(GL_GENERATE_MIPMAP_HINT, GL_FASTEST);
+    m_render_thread.Run([this]() {
+        /* filter quality of generated mipmap images
+         * only available if OpenGL version is 1.4 or greater
+        */
+        if (m_opengl_version >= 1.4f) {
+            if (m_texture_quality > 0.2f) {
+                glHint(GL_GENERATE_MIPMAP_HINT, GL_NICEST);
+            }
+            else {
+                glHint(GL_GENERATE_MIPMAP_HINT, GL_FASTEST);
+            }
         }
-    }
+    });
 }
 
 void cVideo::Init_Resolution_Scale(void) const
@@ -663,65 +729,29 @@ vector<cSize_Int> cVideo::Get_Supported_Resolutions(int flags /* = 0 */) const
     return valid_resolutions;
 }
 
-void cVideo::Make_GL_Context_Current(void)
-{
-// Not ported to SFML yet, because unused function
-// Part of the unfinished separate rendering thread implementation in TSC
-// (TSC_RENDER_THREAD_TEST macro).
-    throw(std::runtime_error("Make_GL_Context_Current() not implemented"));
-
-// scoped context lock here
-//#ifdef _WIN32
-//    if (wglGetCurrentContext() != wm_info.hglrc) {
-//        wglMakeCurrent(GetDC(wm_info.window), wm_info.hglrc);
-//    }
-//#elif __unix__
-//    if (glx_context != NULL) {
-//        glXMakeCurrent(wm_info.info.x11.gfxdisplay, wm_info.info.x11.window, glx_context);
-//    }
-//#elif __APPLE__
-//    // party time
-//#endif
-}
-
-void cVideo::Make_GL_Context_Inactive(void)
-{
-#ifdef _WIN32
-    wglMakeCurrent(NULL, NULL);
-#elif __unix__
-    // OLD glXMakeCurrent(wm_info.info.x11.gfxdisplay, None, NULL);
-#elif __APPLE__
-    // party time
-#endif
-}
-
-void cVideo::Render_From_Thread(void)
+void cVideo::Render(void)
 {
-    Make_GL_Context_Current();
-
-    pRenderer_current->Render();
-    // under linux with sofware mesa 7.9 it only showed the rendered output with SDL_GL_SwapBuffers()
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
 
-    // update performance timer
-    //pFramerate->m_perf_timer[PERF_RENDER_GAME]->Update();
+    // render thread mode
+    if (m_render_thread.Is_Running()) {
+        // textures CEGUI created in the context of this thread must be complete before they are drawn
+        glFlush();
 
-    Make_GL_Context_Inactive();
-}
-
-void cVideo::Render(bool threaded /* = 0 */)
-{
-    Render_Finish();
-
-    if (threaded) {
-        CEGUI::System::getSingleton().renderAllGUIContexts();
+        /* the GUI is rendered over the previous game frame
+         * wait for it as the GUI windows are changed by this thread
+        */
+        m_render_thread.Run([]() {
+            CEGUI::System::getSingleton().renderAllGUIContexts();
+        });
 
         // update performance timer
         pFramerate->m_perf_timer[PERF_RENDER_GUI]->Update();
 
-        mp_window->display();
-
-        // update performance timer
-        pFramerate->m_perf_timer[PERF_RENDER_BUFFER]->Update();
+        sf::RenderWindow* window = mp_window;
+        m_render_thread.Post([window]() {
+            window->display();
+        });
 
         // switch active renderer
         cRenderQueue* new_render = pRenderer;
@@ -734,13 +764,26 @@ void cVideo::Render(bool threaded /* = 0 */)
             pRenderer->m_render_data.clear();
         }
 
-        // make main thread inactive
-        Make_GL_Context_Inactive();
-        // start render thread
-        m_render_thread = boost::thread(&cVideo::Render_From_Thread, this);
+        // the camera is moved while the game is rendered
+        if (pActive_Camera) {
+            pRenderer_current->Set_Camera(pActive_Camera->m_x, pActive_Camera->m_y);
+        }
+
+        // render the game while the next frame is updated
+        cRenderQueue* queue = pRenderer_current;
+        m_render_thread.Post([queue]() {
+            queue->Render();
+        });
+
+        // update performance timer
+        pFramerate->m_perf_timer[PERF_RENDER_GAME]->Update();
     }
     // single thread mode
     else {
+        if (pActive_Camera) {
+            pRenderer->Set_Camera(pActive_Camera->m_x, pActive_Camera->m_y);
+        }
+
         pRenderer->Render();
 
         // update performance timer
@@ -757,37 +800,42 @@ void cVideo::Render(bool threaded /* = 0 */)
         // update performance timer
         pFramerate->m_perf_timer[PERF_RENDER_BUFFER]->Update();
     }
+
+    const uint32_t elapsed = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+    pFramerate->Update_Render_Time(elapsed, m_render_thread.Take_Busy_Time(), m_render_thread.Take_Wait_Time());
 }
 
 void cVideo::Render_Finish(void)
 {
-#ifndef TSC_RENDER_THREAD_TEST
-    return;
-#endif
-    if (m_render_thread.joinable()) {
-        m_render_thread.join();
-    }
+    m_render_thread.Finish();
+}
 
-    // todo : use opengl in only one thread
-    Make_GL_Context_Current();
+void cVideo::Set_Clear_Color(float red, float green, float blue, float alpha /* = 1.0f */)
+{
+    m_clear_color[0] = red;
+    m_clear_color[1] = green;
+    m_clear_color[2] = blue;
+    m_clear_color[3] = alpha;
+
+    m_render_thread.Post([red, green, blue, alpha]() {
+        glClearColor(red, green, blue, alpha);
+    });
 }
 
 void cVideo::Toggle_Fullscreen(void)
 {
-    Render_Finish();
-
     // toggle fullscreen
     pPreferences->m_video_fullscreen = !pPreferences->m_video_fullscreen;
 
     // save clear color
-    GLclampf clear_color[4];
-    glGetFloatv(GL_COLOR_CLEAR_VALUE, clear_color);
+    float clear_color[4];
+    std::copy(m_clear_color, m_clear_color + 4, clear_color);
 
     // Video must be reinitialized
     Init_Video();
 
     // set back clear color
-    glClearColor(clear_color[0], clear_color[1], clear_color[2], clear_color[3]);
+    Set_Clear_Color(clear_color[0], clear_color[1], clear_color[2], clear_color[3]);
 }
 
 cGL_Surface* cVideo::Get_Surface(fs::path filename, bool print_errors /* = true */)
@@ -818,8 +866,12 @@ cGL_Surface* cVideo::Get_Surface(fs::path filename, bool print_errors /* = true
     return image;
 }
 
-cVideo::cSoftware_Image cVideo::Load_Image(boost::filesystem::path filename, bool load_settings /* = 1 */, bool print_errors /* = 1 */) const
+cVideo::cSoftware_Image cVideo::Load_Image(boost::filesystem::path filename, bool load_settings /* = 1 */, bool print_errors /* = 1 */, cImage_Settings_Parser* settings_parser /* = NULL */) const
 {
+    if (!settings_parser) {
+        settings_parser = pSettingsParser;
+    }
+
     // pixmaps dir must be given
     if (!filename.is_absolute()) {
         filename = fs::absolute(filename, pResource_Manager->Get_Game_Pixmaps_Directory());
@@ -840,7 +892,7 @@ cVideo::cSoftware_Image cVideo::Load_Image(boost::filesystem::path filename, boo
             settings_file.replace_extension(".settings");
 
         if (fs::exists(settings_file) && fs::is_regular_file(settings_file)) {
-            settings = pSettingsParser->Get(settings_file);
+            settings = settings_parser->Get(settings_file);
 
             // add cache dir and remove data dir
             fs::path img_filename_cache = m_imgcache_dir / fs_relative(pResource_Manager->Get_Game_Data_Directory(), filename);
@@ -914,7 +966,18 @@ cGL_Surface* cVideo::Load_GL_Surface(boost::filesystem::path filename, bool use_
     }
 
     // load software image
-    cSoftware_Image software_image = Load_Image(filename, use_settings, print_errors);
+    cSoftware_Image software_image;
+
+    // decoded in the background by the level preloader
+    if (!use_settings || !pLevel_Manager || !pLevel_Manager->m_preloader->Take_Image(filename, software_image)) {
+        software_image = Load_Image(filename, use_settings, print_errors);
+    }
+
+    return Create_GL_Surface(software_image, filename, print_errors);
+}
+
+cGL_Surface* cVideo::Create_GL_Surface(cSoftware_Image& software_image, const boost::filesystem::path& filename, bool print_errors /* = 1 */)
+{
     sf::Image* p_sf_image = software_image.m_sf_image;
     cImage_Settings_Data* settings = software_image.m_settings;
 
@@ -985,60 +1048,22 @@ cGL_Surface* cVideo::Create_Texture(sf::Image* p_sf_image, bool mipmap /* = 0 */
         return NULL;
     }
 
-    // create final image
-    p_sf_image = Convert_To_Final_Software_Image(p_sf_image);
-
-    /* todo : Make this a render request because it forces an early thread render finish as opengl commands are used directly.
-     * Reduces performance if the render thread is on. It's usually called from the text rendering in cTimeDisplay::Update.
-    */
-    pVideo->Render_Finish();
-
-    // create one texture
-    GLuint image_num = 0;
-    glGenTextures(1, &image_num);
+    const cTexture_Layout layout = Get_Texture_Layout(p_sf_image->getSize().x, p_sf_image->getSize().y, m_npot_textures, force_width, force_height, m_max_texture_size);
 
-    // if image id is 0 it failed
-    if (!image_num) {
-        cerr << "Error : GL image generation failed" << endl;
-        delete p_sf_image;
-        return NULL;
-    }
-
-    // set highest texture id
-    if (pImage_Manager->m_high_texture_id < image_num) {
-        pImage_Manager->m_high_texture_id = image_num;
-    }
-
-    int width = p_sf_image->getSize().x;
-    int height = p_sf_image->getSize().y;
-
-    // forced size is set
-    if (force_width > 0 && force_height > 0) {
-        // get power of two size
-        force_width = Get_Power_of_2(force_width);
-        force_height = Get_Power_of_2(force_height);
-
-        // apply forced size
-        if (force_width != width || force_height != height) {
-            width = force_width;
-            height = force_height;
-        }
+    // create final image if the texture needs a power of two size
+    if (layout.m_pad) {
+        p_sf_image = Convert_To_Final_Software_Image(p_sf_image);
     }
 
     // texture size
-    int texture_width = width;
-    int texture_height = height;
-    // check if the image size is greater than the maximum texture size
-    Apply_Max_Texture_Size(texture_width, texture_height);
+    const unsigned int texture_width = layout.m_texture_width;
+    const unsigned int texture_height = layout.m_texture_height;
 
     // scale to new size
     if (texture_width != p_sf_image->getSize().x || texture_height != p_sf_image->getSize().y) {
-        int reduce_block_x = p_sf_image->getSize().x / texture_width;
-        int reduce_block_y = p_sf_image->getSize().y / texture_height;
-
         // create scaled image
         unsigned char* new_pixels = static_cast<unsigned char*>(malloc(texture_width * texture_height * 4));
-        Downscale_Image(static_cast<const unsigned char*>(p_sf_image->getPixelsPtr()), p_sf_image->getSize().x, p_sf_image->getSize().y, 8 /* getPixelsPtr() guarantees 8 BPP */, new_pixels, reduce_block_x, reduce_block_y);
+        Downscale_Image(static_cast<const unsigned char*>(p_sf_image->getPixelsPtr()), p_sf_image->getSize().x, p_sf_image->getSize().y, 8 /* getPixelsPtr() guarantees 8 BPP */, new_pixels, layout.m_reduce_x, layout.m_reduce_y);
 
         sf::Image* p_new_image = new sf::Image();
         p_new_image->create(texture_width, texture_height, static_cast<const uint8_t*>(new_pixels));
@@ -1049,44 +1074,72 @@ cGL_Surface* cVideo::Create_Texture(sf::Image* p_sf_image, bool mipmap /* = 0 */
         free(new_pixels);
     }
 
-    // use the generated texture
-    glBindTexture(GL_TEXTURE_2D, image_num);
+    /* upload in the render thread
+     * It's usually called from the text rendering in cTimeDisplay::Update and waits for the frame in rendering.
+    */
+    GLuint image_num = 0;
+
+    pVideo->m_render_thread.Run([&]() {
+        // create one texture
+        glGenTextures(1, &image_num);
+
+        // if image id is 0 it failed
+        if (!image_num) {
+            return;
+        }
 
-    // set texture wrap modes which control how to interpret texture coordinates
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    // set texture magnification function
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    // upload to OpenGL texture
-    Create_GL_Texture(texture_width, texture_height, p_sf_image->getPixelsPtr(), mipmap);
+        // use the generated texture
+        glBindTexture(GL_TEXTURE_2D, image_num);
+
+        // set texture wrap modes which control how to interpret texture coordinates
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        // set texture magnification function
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        // upload to OpenGL texture
+        Create_GL_Texture(texture_width, texture_height, p_sf_image->getPixelsPtr(), mipmap);
+
+        // unset pixel store mode
+        // OLD (see corresponding call further above) glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+
+        // if debug build check for errors
+#ifdef _DEBUG
+        // glGetError only saves one error flag
+        GLenum error = glGetError();
 
-    // unset pixel store mode
-    // OLD (see corresponding call further above) glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+        if (error != GL_NO_ERROR) {
+            cerr << "CreateTexture : GL Error found : " << gluErrorString(error) << endl;
+        }
+#endif
+    });
 
     delete p_sf_image;
 
+    // if image id is 0 it failed
+    if (!image_num) {
+        cerr << "Error : GL image generation failed" << endl;
+        return NULL;
+    }
+
+    // set highest texture id
+    if (pImage_Manager->m_high_texture_id < image_num) {
+        pImage_Manager->m_high_texture_id = image_num;
+    }
+
     // create OpenGL surface class
     cGL_Surface* image = new cGL_Surface();
     image->m_image = image_num;
     image->m_tex_w = texture_width;
     image->m_tex_h = texture_height;
-    image->m_start_w = static_cast<float>(width);
-    image->m_start_h = static_cast<float>(height);
+    image->m_content_w = layout.m_content_w;
+    image->m_content_h = layout.m_content_h;
+    image->m_start_w = static_cast<float>(layout.m_width);
+    image->m_start_h = static_cast<float>(layout.m_height);
     image->m_w = image->m_start_w;
     image->m_h = image->m_start_h;
     image->m_col_w = image->m_w;
     image->m_col_h = image->m_h;
 
-    // if debug build check for errors
-#ifdef _DEBUG
-    // glGetError only saves one error flag
-    GLenum error = glGetError();
-
-    if (error != GL_NO_ERROR) {
-        cerr << "CreateTexture : GL Error found : " << gluErrorString(error) << endl;
-    }
-#endif
-
     return image;
 }
 
@@ -1124,7 +1177,9 @@ Color cVideo::Get_Pixel(int x, int y) const
 {
     GLubyte* pixel = new GLubyte[3];
     // read it
-    glReadPixels(x, y, 1, 1, GL_RGB, GL_UNSIGNED_BYTE, pixel);
+    pVideo->m_render_thread.Run([x, y, pixel]() {
+        glReadPixels(x, y, 1, 1, GL_RGB, GL_UNSIGNED_BYTE, pixel);
+    });
 
     // convert to color
     Color color = Color(pixel[0], pixel[1], pixel[2]);
@@ -1322,30 +1377,7 @@ float cVideo::Get_Scale(const cGL_Surface* image, float width, float height, boo
 
 void cVideo::Apply_Max_Texture_Size(int& width, int& height) const
 {
-    if (width > m_max_texture_size) {
-        // change height to keep aspect ratio
-        int scale_down = width / m_max_texture_size;
-
-        if (scale_down < 1) {
-            debug_print("Warning : image height scale down %d is invalid\n", scale_down);
-            scale_down = 1;
-        }
-
-        height = height / scale_down;
-        width = m_max_texture_size;
-    }
-    if (height > m_max_texture_size) {
-        // change width to keep aspect ratio
-        int scale_down = height / m_max_texture_size;
-
-        if (scale_down < 1) {
-            debug_print("Warning : image width scale down %d is invalid\n", scale_down);
-            scale_down = 1;
-        }
-
-        width = width / scale_down;
-        height = m_max_texture_size;
-    }
+    TSC::Apply_Max_Texture_Size(width, height, m_max_texture_size);
 }
 
 /* function from Jonathan Dummer
@@ -1415,8 +1447,6 @@ bool cVideo::Downscale_Image(const unsigned char* const orig, int width, int hei
 
 void cVideo::Save_Screenshot(void)
 {
-    Render_Finish();
-
     fs::path filename;
 
     for (unsigned int i = 1; i < 1000; i++) {
@@ -1426,7 +1456,9 @@ void cVideo::Save_Screenshot(void)
             // create image data
             GLubyte* data = new GLubyte[pPreferences->m_video_screen_w * pPreferences->m_video_screen_h * 3];
             // read opengl screen
-            glReadPixels(0, 0, pPreferences->m_video_screen_w, pPreferences->m_video_screen_h, GL_RGB, GL_UNSIGNED_BYTE, static_cast<GLvoid*>(data));
+            m_render_thread.Run([data]() {
+                glReadPixels(0, 0, pPreferences->m_video_screen_w, pPreferences->m_video_screen_h, GL_RGB, GL_UNSIGNED_BYTE, static_cast<GLvoid*>(data));
+            });
             // save
             Save_Surface(filename, data, pPreferences->m_video_screen_w, pPreferences->m_video_screen_h, 3, 1);
             // clear data
@@ -20,6 +20,7 @@
 #include "../core/global_basic.hpp"
 #include "../core/global_game.hpp"
 #include "../video/color.hpp"
+#include "../video/render_thread.hpp"
 
 namespace TSC {
 
@@ -56,7 +57,8 @@ namespace TSC {
         ~cVideo(void);
 
         /* Initialize the screen surface
-         * reload_textures_from_file: if set reloads all textures from the original file
+         * reload_textures_from_file: if set reinitializes the image cache for the new size
+         * Textures with an image file are always reloaded from it or the image cache.
          * use_preferences: if set use user preferences settings
          * shows an error if failed and exits
          * Calls several subinitialisations.
@@ -82,18 +84,18 @@ namespace TSC {
         */
         vector<cSize_Int> Get_Supported_Resolutions(int flags = 0) const;
 
-        // make the opengl context active for the current thread
-        void Make_GL_Context_Current(void);
-        // make the opengl context inactive for the current thread
-        void Make_GL_Context_Inactive(void);
-
-        // Render. Should be called from a thread
-        void Render_From_Thread(void);
-        // Render game, GUI and swap the opengl buffer
-        void Render(bool threaded = 0);
-        // Finish thread rendering
+        /* Render game, GUI and swap the opengl buffer
+         * If the render thread is running the game is rendered by it while the
+         * next frame is updated. The GUI is rendered over the previous game
+         * frame while waiting for it as the main thread changes the GUI.
+        */
+        void Render(void);
+        // Wait until the render thread is done with all frames and commands
         void Render_Finish(void);
 
+        // Set the color the screen is cleared with
+        void Set_Clear_Color(float red, float green, float blue, float alpha = 1.0f);
+
         // Toggle fullscreen video mode ( new mode is set to preferences )
         void Toggle_Fullscreen(void);
 
@@ -120,8 +122,10 @@ namespace TSC {
          * The returned image should be deleted if not used anymore but not the settings data which is managed
          * load_settings : enable file settings if set to 1
          * print_errors : print errors if image couldn't be created or loaded
+         * settings_parser : parser for the settings files, the global one if not set.
+         *   Threads other than the main thread must pass their own parser.
         */
-        cSoftware_Image Load_Image(boost::filesystem::path filename, bool load_settings = 1, bool print_errors = 1) const;
+        cSoftware_Image Load_Image(boost::filesystem::path filename, bool load_settings = 1, bool print_errors = 1, cImage_Settings_Parser* settings_parser = NULL) const;
 
         /* Load and return the hardware image
          * use_settings : enable file settings if set to 1
@@ -129,6 +133,11 @@ namespace TSC {
          * The returned image should be deleted if not used anymore
         */
         cGL_Surface* Load_GL_Surface(boost::filesystem::path filename, bool use_settings = 1, bool print_errors = 1);
+        /* Create the hardware image from a software image returned by Load_Image
+         * The software image and its settings are deleted.
+         * filename : the absolute filename the image was loaded from
+        */
+        cGL_Surface* Create_GL_Surface(cSoftware_Image& software_image, const boost::filesystem::path& filename, bool print_errors = 1);
 
         /* Convert to a scaled software image with a power of 2 size and 32 bits per pixel.
          * Conversion only happens if needed.
@@ -140,6 +149,7 @@ namespace TSC {
         sf::Image* Convert_To_Final_Software_Image(sf::Image* p_sf_image) const;
 
         /* Convert an SFML image to a GL image
+         * Uploaded without padding if non-power-of-two textures are supported.
          * surface : the source SFML image which will be auto-deleted.
          * mipmap : create texture mipmaps
          * force_width/height : force the given width and height
@@ -200,6 +210,8 @@ namespace TSC {
 
         // available OpenGL version
         float m_opengl_version;
+        // if textures can have a non-power-of-two size
+        bool m_npot_textures;
 
         // using double buffering
         bool m_double_buffer;
@@ -231,8 +243,12 @@ namespace TSC {
         // current opengl context
         GLXContext glx_context;
 #endif
-        // rendering thread
-        boost::thread m_render_thread;
+        /* rendering thread
+         * opengl calls outside of render requests must be passed to it
+        */
+        cRender_Thread m_render_thread;
+        // current clear color
+        float m_clear_color[4];
 
         // GUI System
         CEGUI::OpenGLRenderer* mp_cegui_renderer;
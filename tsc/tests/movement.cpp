@@ -0,0 +1,239 @@
+/***************************************************************************
+ * movement.cpp - Collision movement tests
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "tests.hpp"
+#include "../src/core/sprite_manager.hpp"
+#include "../src/core/collision.hpp"
+#include "../src/core/camera.hpp"
+#include "../src/core/game_core.hpp"
+#include "../src/objects/movingsprite.hpp"
+#include "../src/video/gl_surface.hpp"
+
+using namespace std;
+
+namespace TSC {
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+// A block of the test level
+struct cMovement_Block {
+    float m_x;
+    float m_y;
+    // size in blocks
+    int m_w;
+    int m_h;
+    MassiveType m_massive_type;
+};
+
+// ground with a gap, a wall, a halfmassive platform and a ceiling
+static const cMovement_Block movement_blocks[] = {
+    { 0.0f, 0.0f, 12, 2, MASS_MASSIVE },
+    { 448.0f, 0.0f, 20, 2, MASS_MASSIVE },
+    { 576.0f, -96.0f, 1, 3, MASS_MASSIVE },
+    { 160.0f, -160.0f, 4, 1, MASS_HALFMASSIVE },
+    { 704.0f, -320.0f, 6, 1, MASS_MASSIVE },
+    { 800.0f, -64.0f, 3, 1, MASS_HALFMASSIVE }
+};
+
+// A recorded movement of one sprite
+struct cMovement_Case {
+    const char* m_name;
+    // start position
+    float m_pos_x;
+    float m_pos_y;
+    // start velocity
+    float m_velx;
+    float m_vely;
+    // added to the vertical velocity each frame if not on ground
+    float m_gravity;
+    unsigned int m_frames;
+};
+
+static const cMovement_Case movement_cases[] = {
+    { "fall_on_ground", 40.0f, -300.0f, 0.0f, 0.0f, 1.5f, 40 },
+    { "run_into_wall", 420.0f, -41.0f, 7.3f, 0.0f, 1.0f, 30 },
+    { "run_into_wall_left", 700.3f, -41.0f, -5.7f, 0.5f, 1.0f, 40 },
+    { "fast_diagonal", 30.0f, -400.0f, 23.5f, 17.25f, 0.0f, 20 },
+    { "jump_through_halfmassive", 180.0f, -41.0f, 0.0f, -14.0f, 0.6f, 60 },
+    { "land_on_halfmassive", 820.0f, -250.0f, 1.25f, 0.0f, 0.8f, 40 },
+    { "hit_ceiling", 740.0f, -90.0f, 0.0f, -9.5f, 0.4f, 30 },
+    { "fall_into_gap", 300.0f, -60.0f, 3.1f, 0.0f, 1.2f, 30 },
+    { "free_flight", 0.0f, -2000.0f, 31.0f, 0.0f, 0.0f, 20 },
+    { "slide_on_ground", 20.0f, -40.5f, 9.9f, 0.1f, 1.0f, 50 }
+};
+
+// Position and collisions after one frame
+struct cMovement_Frame {
+    float m_pos_x;
+    float m_pos_y;
+    // index of the ground object or -1
+    int m_ground;
+    // index, direction and validation of each collision
+    vector<int> m_collisions;
+};
+
+// index of the sprite in the level or -1
+static int Get_Movement_Index(const cSprite_Manager& sprite_manager, const cSprite* sprite)
+{
+    cSprite_List::const_iterator itr = std::find(sprite_manager.objects.begin(), sprite_manager.objects.end(), sprite);
+
+    if (itr == sprite_manager.objects.end()) {
+        return -1;
+    }
+
+    return static_cast<int>(itr - sprite_manager.objects.begin());
+}
+
+// Move a sprite through the level and record each frame
+static vector<cMovement_Frame> Record_Movement(cSprite_Manager& sprite_manager, cGL_Surface* surface, const cMovement_Case& movement)
+{
+    vector<cMovement_Frame> frames;
+
+    cMovingSprite sprite(&sprite_manager);
+    sprite.m_sprite_array = ARRAY_ACTIVE;
+    sprite.m_can_be_on_ground = 1;
+    sprite.Set_Image(surface, 1);
+    sprite.Set_Pos(movement.m_pos_x, movement.m_pos_y, 1);
+    sprite.m_velx = movement.m_velx;
+    sprite.m_vely = movement.m_vely;
+
+    for (unsigned int i = 0; i < movement.m_frames; i++) {
+        if (!sprite.m_ground_object) {
+            sprite.m_vely += movement.m_gravity;
+        }
+        else if (sprite.m_vely > 0.0f) {
+            sprite.m_vely = 0.0f;
+        }
+
+        sprite.Col_Move(sprite.m_velx, sprite.m_vely, 1);
+
+        cMovement_Frame frame;
+        frame.m_pos_x = sprite.m_pos_x;
+        frame.m_pos_y = sprite.m_pos_y;
+        frame.m_ground = Get_Movement_Index(sprite_manager, sprite.m_ground_object);
+
+        for (cObjectCollision_List::const_iterator itr = sprite.m_collisions.begin(); itr != sprite.m_collisions.end(); ++itr) {
+            const cObjectCollision* col = (*itr);
+
+            frame.m_collisions.push_back(Get_Movement_Index(sprite_manager, col->m_obj));
+            frame.m_collisions.push_back(col->m_direction);
+            frame.m_collisions.push_back(col->m_valid_type);
+
+            // blocked
+            if (col->m_valid_type == COL_VTYPE_BLOCKING) {
+                if (col->m_direction == DIR_LEFT || col->m_direction == DIR_RIGHT) {
+                    sprite.m_velx = 0.0f;
+                }
+                else if (col->m_direction == DIR_TOP && sprite.m_vely < 0.0f) {
+                    sprite.m_vely = 0.0f;
+                }
+            }
+        }
+
+        frames.push_back(frame);
+
+        // collisions are handled each frame
+        sprite.Clear_Collisions();
+
+        for (cSprite_List::iterator itr = sprite_manager.objects.begin(); itr != sprite_manager.objects.end(); ++itr) {
+            (*itr)->Clear_Collisions();
+        }
+    }
+
+    return frames;
+}
+
+/* Compare the collision moves skipping the free steps with the plain stepping
+ * the positions may only differ by the float rounding of the skipped distance
+*/
+void Test_Movement(cTest_Runner& runner)
+{
+    if (!runner.Is_Enabled("movement")) {
+        return;
+    }
+
+    // block image without a texture
+    cGL_Surface block_surface;
+    block_surface.m_auto_del_img = 0;
+    block_surface.m_w = block_surface.m_start_w = block_surface.m_col_w = 32.0f;
+    block_surface.m_h = block_surface.m_start_h = block_surface.m_col_h = 32.0f;
+
+    // moving sprite image
+    cGL_Surface sprite_surface;
+    sprite_surface.m_auto_del_img = 0;
+    sprite_surface.m_w = sprite_surface.m_start_w = sprite_surface.m_col_w = 24.0f;
+    sprite_surface.m_h = sprite_surface.m_start_h = sprite_surface.m_col_h = 40.0f;
+
+    cSprite_Manager sprite_manager(200);
+
+    for (unsigned int i = 0; i < sizeof(movement_blocks) / sizeof(movement_blocks[0]); i++) {
+        const cMovement_Block& block = movement_blocks[i];
+
+        for (int y = 0; y < block.m_h; y++) {
+            for (int x = 0; x < block.m_w; x++) {
+                cSprite* sprite = new cSprite(&sprite_manager);
+                sprite->Set_Image(&block_surface, 1);
+                sprite->Set_Pos(block.m_x + (x * 32.0f), block.m_y + (y * 32.0f), 1);
+                sprite_manager.Add(sprite);
+                sprite->Set_Massive_Type(block.m_massive_type);
+            }
+        }
+    }
+
+    // used for the level limits
+    cCamera camera(&sprite_manager);
+    pActive_Camera = &camera;
+
+    // a player far away
+    cSprite player(&sprite_manager);
+    player.Set_Image(&sprite_surface, 1);
+    player.Set_Pos(-50000.0f, -50000.0f, 1);
+    pActive_Player = &player;
+
+    for (unsigned int i = 0; i < sizeof(movement_cases) / sizeof(movement_cases[0]); i++) {
+        const cMovement_Case& movement = movement_cases[i];
+
+        if (!runner.Start(std::string("movement_") + movement.m_name)) {
+            continue;
+        }
+
+        cMovingSprite::m_skip_free_steps = 0;
+        const vector<cMovement_Frame> expected = Record_Movement(sprite_manager, &sprite_surface, movement);
+        cMovingSprite::m_skip_free_steps = 1;
+        const vector<cMovement_Frame> frames = Record_Movement(sprite_manager, &sprite_surface, movement);
+
+        for (unsigned int frame = 0; frame < expected.size(); frame++) {
+            const std::string at = " at frame " + int_to_string(frame);
+
+            if (!runner.Check(fabs(frames[frame].m_pos_x - expected[frame].m_pos_x) < 0.01f && fabs(frames[frame].m_pos_y - expected[frame].m_pos_y) < 0.01f, "position " + float_to_string(frames[frame].m_pos_x) + ", " + float_to_string(frames[frame].m_pos_y) + " expected " + float_to_string(expected[frame].m_pos_x) + ", " + float_to_string(expected[frame].m_pos_y) + at)) {
+                break;
+            }
+            if (!runner.Check(frames[frame].m_ground == expected[frame].m_ground, "ground object " + int_to_string(frames[frame].m_ground) + " expected " + int_to_string(expected[frame].m_ground) + at)) {
+                break;
+            }
+            if (!runner.Check(frames[frame].m_collisions == expected[frame].m_collisions, "collisions differ" + at)) {
+                break;
+            }
+        }
+    }
+
+    pActive_Player = NULL;
+    pActive_Camera = NULL;
+    cMovingSprite::m_skip_free_steps = 1;
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
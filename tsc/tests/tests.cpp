@@ -0,0 +1,110 @@
+/***************************************************************************
+ * tests.cpp - Core tests
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "tests.hpp"
+#include "../src/core/framerate.hpp"
+#include "../src/video/video.hpp"
+
+using namespace std;
+
+namespace TSC {
+
+/* *** *** *** *** *** cTest_Runner *** *** *** *** *** *** *** *** *** *** *** *** */
+
+cTest_Runner::cTest_Runner(void)
+{
+    m_tests = 0;
+    m_checks = 0;
+    m_failures = 0;
+}
+
+bool cTest_Runner::Is_Enabled(const std::string& name) const
+{
+    return m_filter.empty() || name.find(m_filter) != std::string::npos;
+}
+
+bool cTest_Runner::Start(const std::string& name)
+{
+    if (!Is_Enabled(name)) {
+        return 0;
+    }
+
+    cerr << "Running " << name << endl;
+
+    m_test = name;
+    m_tests++;
+    return 1;
+}
+
+bool cTest_Runner::Check(bool result, const std::string& message)
+{
+    m_checks++;
+
+    if (!result) {
+        m_failures++;
+        cerr << "FAILED " << m_test << " : " << message << endl;
+    }
+
+    return result;
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+using namespace TSC;
+
+int main(int argc, char** argv)
+{
+    cTest_Runner runner;
+
+    vector<std::string> arguments(argv, argv + argc);
+
+    for (unsigned int i = 1; i < arguments.size(); i++) {
+        if (arguments[i] == "--help" || arguments[i] == "-h") {
+            cout << "Usage: " << arguments[0] << " [OPTIONS]" << endl;
+            cout << "Where OPTIONS is one of the following:" << endl;
+            cout << "-h, --help\tDisplay this message" << endl;
+            cout << "-f, --filter\tOnly run tests containing the given text" << endl;
+            return EXIT_SUCCESS;
+        }
+        else if (i + 1 >= arguments.size()) {
+            cerr << "Unknown argument " << arguments[i] << endl << "Use -h to list all possible arguments" << endl;
+            return EXIT_FAILURE;
+        }
+        else if (arguments[i] == "--filter" || arguments[i] == "-f") {
+            runner.m_filter = arguments[++i];
+        }
+        else {
+            cerr << "Unknown argument " << arguments[i] << endl << "Use -h to list all possible arguments" << endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    // used by the sprites
+    pFramerate = new cFramerate();
+    // no window is opened. Not deleted as the destructor expects an initialized CEGUI.
+    pVideo = new cVideo();
+
+    Test_Movement(runner);
+    Test_Texture_Layout(runner);
+
+    delete pFramerate;
+    pFramerate = NULL;
+
+    cout << runner.m_tests << " tests, " << runner.m_checks << " checks, " << runner.m_failures << " failed" << endl;
+
+    return runner.m_failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
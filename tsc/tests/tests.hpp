@@ -0,0 +1,65 @@
+/***************************************************************************
+ * tests.hpp - Core tests
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TSC_TESTS_HPP
+#define TSC_TESTS_HPP
+
+#include "../src/core/global_basic.hpp"
+
+namespace TSC {
+
+    /* *** *** *** *** *** cTest_Runner *** *** *** *** *** *** *** *** *** *** *** *** */
+
+    /* Counts the checks of the core tests and prints the failed ones
+     * The tests run without opening a window so they can not use OpenGL.
+     * Failures go to stderr and the summary to stdout.
+    */
+    class cTest_Runner {
+    public:
+        cTest_Runner(void);
+
+        // returns true if the test with the given name should run
+        bool Is_Enabled(const std::string& name) const;
+
+        // Start the test with the given name, returns false if it is filtered out
+        bool Start(const std::string& name);
+        /* Count a check and print the message if it failed
+         * returns the result
+        */
+        bool Check(bool result, const std::string& message);
+
+        // only run tests with a name containing this text
+        std::string m_filter;
+        // name of the running test
+        std::string m_test;
+        // tests started
+        unsigned int m_tests;
+        // checks done
+        unsigned int m_checks;
+        // checks failed
+        unsigned int m_failures;
+    };
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+    // test groups
+    void Test_Movement(cTest_Runner& runner);
+    void Test_Texture_Layout(cTest_Runner& runner);
+
+    /* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC
+
+#endif
@@ -0,0 +1,126 @@
+/***************************************************************************
+ * texture_layout.cpp - Texture layout tests
+ *
+ * Copyright © 2012-2020 The TSC Contributors
+ ***************************************************************************/
+/*
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "tests.hpp"
+#include "../src/video/texture_layout.hpp"
+#include "../src/core/property_helper.hpp"
+
+using namespace std;
+
+namespace TSC {
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+// An image with its expected layout
+struct cLayout_Case {
+    const char* m_name;
+    // image
+    unsigned int m_image_width;
+    unsigned int m_image_height;
+    bool m_npot;
+    unsigned int m_force_width;
+    unsigned int m_force_height;
+    int m_max_texture_size;
+    // expected layout
+    unsigned int m_width;
+    unsigned int m_height;
+    unsigned int m_texture_width;
+    unsigned int m_texture_height;
+    unsigned int m_reduce_x;
+    unsigned int m_reduce_y;
+    bool m_pad;
+    float m_content_w;
+    float m_content_h;
+};
+
+static const cLayout_Case layout_cases[] = {
+    // power of two input is never padded
+    { "pot", 64, 32, 0, 0, 0, 2048, 64, 32, 64, 32, 1, 1, 0, 1.0f, 1.0f },
+    { "pot_npot_support", 64, 32, 1, 0, 0, 2048, 64, 32, 64, 32, 1, 1, 0, 1.0f, 1.0f },
+    // padded without support and uploaded as is with it
+    { "npot_padded", 100, 50, 0, 0, 0, 2048, 128, 64, 128, 64, 1, 1, 1, 1.0f, 1.0f },
+    { "npot", 100, 50, 1, 0, 0, 2048, 128, 64, 100, 50, 1, 1, 0, 0.78125f, 0.78125f },
+    // forced bigger drawing size
+    { "forced_bigger_npot", 100, 50, 1, 200, 60, 2048, 256, 64, 100, 50, 1, 1, 0, 0.78125f, 0.78125f },
+    // forced smaller drawing size downscales the texture
+    { "forced_smaller_padded", 100, 50, 0, 32, 16, 2048, 32, 16, 32, 16, 4, 4, 1, 1.0f, 1.0f },
+    { "forced_smaller_npot", 100, 50, 1, 32, 16, 2048, 32, 16, 25, 12, 4, 4, 0, 0.78125f, 0.78125f },
+    // clamped to the maximum texture size
+    { "max_size_pot", 4096, 1024, 0, 0, 0, 2048, 4096, 1024, 2048, 512, 2, 2, 0, 1.0f, 1.0f },
+    { "max_size_padded", 3000, 1000, 0, 0, 0, 2048, 4096, 1024, 2048, 512, 2, 2, 1, 1.0f, 1.0f },
+    { "max_size_npot", 3000, 1000, 1, 0, 0, 2048, 4096, 1024, 1500, 500, 2, 2, 0, 0.732421875f, 0.9765625f },
+    { "max_size_height", 512, 8192, 0, 0, 0, 4096, 512, 8192, 256, 4096, 2, 2, 0, 1.0f, 1.0f }
+};
+
+// Check the size calculations used when uploading images
+void Test_Texture_Layout(cTest_Runner& runner)
+{
+    for (unsigned int i = 0; i < sizeof(layout_cases) / sizeof(layout_cases[0]); i++) {
+        const cLayout_Case& test = layout_cases[i];
+
+        if (!runner.Start(std::string("texture_layout_") + test.m_name)) {
+            continue;
+        }
+
+        const cTexture_Layout layout = Get_Texture_Layout(test.m_image_width, test.m_image_height, test.m_npot, test.m_force_width, test.m_force_height, test.m_max_texture_size);
+
+        runner.Check(layout.m_width == test.m_width && layout.m_height == test.m_height, "size " + uint_to_string(layout.m_width) + "x" + uint_to_string(layout.m_height) + " expected " + uint_to_string(test.m_width) + "x" + uint_to_string(test.m_height));
+        runner.Check(layout.m_texture_width == test.m_texture_width && layout.m_texture_height == test.m_texture_height, "texture size " + uint_to_string(layout.m_texture_width) + "x" + uint_to_string(layout.m_texture_height) + " expected " + uint_to_string(test.m_texture_width) + "x" + uint_to_string(test.m_texture_height));
+        runner.Check(layout.m_reduce_x == test.m_reduce_x && layout.m_reduce_y == test.m_reduce_y, "reduce " + uint_to_string(layout.m_reduce_x) + "x" + uint_to_string(layout.m_reduce_y) + " expected " + uint_to_string(test.m_reduce_x) + "x" + uint_to_string(test.m_reduce_y));
+        runner.Check(layout.m_pad == test.m_pad, test.m_pad ? "not padded" : "padded");
+        runner.Check(Is_Float_Equal(layout.m_content_w, test.m_content_w) && Is_Float_Equal(layout.m_content_h, test.m_content_h), "content " + float_to_string(layout.m_content_w) + "x" + float_to_string(layout.m_content_h) + " expected " + float_to_string(test.m_content_w) + "x" + float_to_string(test.m_content_h));
+
+        // the texture never exceeds the maximum size
+        runner.Check(layout.m_texture_width <= static_cast<unsigned int>(test.m_max_texture_size) && layout.m_texture_height <= static_cast<unsigned int>(test.m_max_texture_size), "texture bigger than the maximum size");
+
+        // an unpadded image covers the same part of the drawing size as in the padded image
+        if (test.m_npot && !layout.m_pad) {
+            const unsigned int pot_width = Get_Power_of_2(test.m_image_width);
+            const unsigned int pot_height = Get_Power_of_2(test.m_image_height);
+
+            runner.Check(Is_Float_Equal(layout.m_content_w * pot_width, static_cast<float>(test.m_image_width)) && Is_Float_Equal(layout.m_content_h * pot_height, static_cast<float>(test.m_image_height)), "content does not match the image size");
+        }
+        // a padded or power of two texture covers the whole drawing size
+        else {
+            runner.Check(Is_Float_Equal(layout.m_content_w, 1.0f) && Is_Float_Equal(layout.m_content_h, 1.0f), "content of a padded texture is not complete");
+        }
+    }
+
+    if (runner.Start("texture_layout_apply_max_size")) {
+        int width = 1000;
+        int height = 300;
+        Apply_Max_Texture_Size(width, height, 2048);
+        runner.Check(width == 1000 && height == 300, "size below the maximum changed");
+
+        width = 5000;
+        height = 300;
+        Apply_Max_Texture_Size(width, height, 2048);
+        runner.Check(width == 2048 && height == 150, "width " + int_to_string(width) + "x" + int_to_string(height) + " expected 2048x150");
+
+        width = 64;
+        height = 9000;
+        Apply_Max_Texture_Size(width, height, 4096);
+        runner.Check(width == 32 && height == 4096, "height " + int_to_string(width) + "x" + int_to_string(height) + " expected 32x4096");
+
+        width = 8192;
+        height = 8192;
+        Apply_Max_Texture_Size(width, height, 2048);
+        runner.Check(width == 2048 && height == 2048, "both " + int_to_string(width) + "x" + int_to_string(height) + " expected 2048x2048");
+    }
+}
+
+/* *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** *** */
+
+} // namespace TSC